@@ -0,0 +1,9 @@
+// mdv_bench: micro-benchmarks for the simulation hot paths
+//
+//   mdv_bench [--filter=<substring>] [--min-time=<s>] [--repetitions=<n>] [--csv=<file>]
+
+#include "Benchmark.h"
+
+int main(int argc, char** argv) {
+    return bench::runAll(argc, argv);
+}
@@ -0,0 +1,161 @@
+#include "Benchmark.h"
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+
+namespace bench {
+
+namespace {
+    struct Entry {
+        std::string name;
+        Function function;
+        int64_t argument;
+        bool hasArgument;
+    };
+
+    std::vector<Entry>& registry() {
+        static std::vector<Entry> entries;
+        return entries;
+    }
+
+    struct Result {
+        std::string name;
+        uint64_t iterations;
+        double medianNs;     // per iteration
+        double minNs;
+        double cvPercent;    // Spread across repetitions
+        double itemsPerSecond;
+    };
+
+    // One timed run of `iterations`; returns seconds and items/iteration
+    double runOnce(const Entry& entry, uint64_t iterations, uint64_t& items) {
+        State state(entry.argument, iterations);
+        entry.function(state);
+        items = state.getItemsPerIteration();
+        return state.elapsedSeconds();
+    }
+
+    Result measure(const Entry& entry, double minTime, int repetitions) {
+        // Calibrate: grow the iteration count until one run is long enough
+        // to extrapolate, then size runs to take minTime each
+        uint64_t items = 0;
+        uint64_t iterations = 1;
+        double elapsed = runOnce(entry, iterations, items);
+        while (elapsed < minTime / 10.0 && iterations < (1ull << 40)) {
+            iterations *= 10;
+            elapsed = runOnce(entry, iterations, items);
+        }
+        if (elapsed < minTime) {
+            double scale = minTime / std::max(elapsed, 1e-9);
+            iterations = static_cast<uint64_t>(std::ceil(iterations * std::min(scale, 100.0)));
+        }
+
+        std::vector<double> perIteration;
+        for (int r = 0; r < repetitions; r++) {
+            perIteration.push_back(runOnce(entry, iterations, items) * 1e9 / iterations);
+        }
+        std::sort(perIteration.begin(), perIteration.end());
+
+        double mean = 0.0;
+        for (double ns : perIteration) mean += ns;
+        mean /= perIteration.size();
+        double variance = 0.0;
+        for (double ns : perIteration) variance += (ns - mean) * (ns - mean);
+        variance /= perIteration.size();
+
+        Result result;
+        result.name = entry.hasArgument ? entry.name + "/" + std::to_string(entry.argument) : entry.name;
+        result.iterations = iterations;
+        result.medianNs = perIteration[perIteration.size() / 2];
+        result.minNs = perIteration.front();
+        result.cvPercent = (mean > 0.0) ? 100.0 * std::sqrt(variance) / mean : 0.0;
+        result.itemsPerSecond = (items > 0) ? items * 1e9 / result.medianNs : 0.0;
+        return result;
+    }
+
+    bool flagValue(const char* arg, const char* flag, std::string& value) {
+        size_t length = std::strlen(flag);
+        if (std::strncmp(arg, flag, length) != 0 || arg[length] != '=') return false;
+        value = arg + length + 1;
+        return true;
+    }
+}
+
+bool registerBenchmark(const std::string& name, Function function, std::vector<int64_t> arguments) {
+    if (arguments.empty()) {
+        registry().push_back({name, function, 0, false});
+    }
+    for (int64_t argument : arguments) {
+        registry().push_back({name, function, argument, true});
+    }
+    return true;
+}
+
+int runAll(int argc, char** argv) {
+    std::string filter;
+    std::string csvPath;
+    double minTime = 0.2;
+    int repetitions = 5;
+
+    for (int i = 1; i < argc; i++) {
+        std::string value;
+        if (flagValue(argv[i], "--filter", value)) {
+            filter = value;
+        } else if (flagValue(argv[i], "--min-time", value)) {
+            minTime = std::atof(value.c_str());
+        } else if (flagValue(argv[i], "--repetitions", value)) {
+            repetitions = std::max(1, std::atoi(value.c_str()));
+        } else if (flagValue(argv[i], "--csv", value)) {
+            csvPath = value;
+        } else {
+            std::cerr << "Usage: " << argv[0]
+                      << " [--filter=<substring>] [--min-time=<s>] [--repetitions=<n>] [--csv=<file>]\n";
+            return 1;
+        }
+    }
+
+#ifndef NDEBUG
+    std::cout << "WARNING: assertions enabled; configure with -DCMAKE_BUILD_TYPE=Release for real numbers\n";
+#endif
+    std::cout << "Repetitions: " << repetitions << ", min time: " << minTime << " s\n\n";
+
+    char line[256];
+    std::snprintf(line, sizeof(line), "%-40s %14s %14s %7s %16s\n",
+                  "Benchmark", "ns/op", "min ns/op", "cv%", "states/s");
+    std::cout << line << std::string(95, '-') << "\n";
+
+    std::vector<Result> results;
+    for (const auto& entry : registry()) {
+        std::string fullName = entry.hasArgument ? entry.name + "/" + std::to_string(entry.argument) : entry.name;
+        if (!filter.empty() && fullName.find(filter) == std::string::npos) continue;
+
+        Result result = measure(entry, minTime, repetitions);
+        results.push_back(result);
+
+        char items[32] = "-";
+        if (result.itemsPerSecond > 0.0) std::snprintf(items, sizeof(items), "%.4g", result.itemsPerSecond);
+        std::snprintf(line, sizeof(line), "%-40s %14.1f %14.1f %7.2f %16s\n",
+                      result.name.c_str(), result.medianNs, result.minNs, result.cvPercent, items);
+        std::cout << line << std::flush;
+    }
+
+    if (!csvPath.empty()) {
+        std::ofstream csv(csvPath);
+        csv << "benchmark,iterations,ns_per_op,min_ns_per_op,cv_percent,states_per_second\n";
+        for (const auto& r : results) {
+            csv << r.name << ',' << r.iterations << ',' << r.medianNs << ',' << r.minNs << ','
+                << r.cvPercent << ',' << r.itemsPerSecond << '\n';
+        }
+        if (!csv) {
+            std::cerr << "Failed to write " << csvPath << "\n";
+            return 1;
+        }
+    }
+    return 0;
+}
+
+} // namespace bench
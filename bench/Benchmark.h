@@ -0,0 +1,92 @@
+#ifndef BENCHMARK_H
+#define BENCHMARK_H
+
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <vector>
+
+/**
+ * Minimal benchmark harness in the spirit of Google Benchmark.
+ *
+ *   static void BM_Something(bench::State& state) {
+ *       Input input = makeInput(state.arg());
+ *       while (state.keepRunning()) {
+ *           bench::doNotOptimize(work(input));
+ *       }
+ *       state.setItemsPerIteration(input.size());
+ *   }
+ *   MDV_BENCHMARK_ARGS(BM_Something, 10, 100, 1000);
+ *
+ * Each benchmark is calibrated to run for at least --min-time seconds per
+ * repetition; the report gives the median over --repetitions runs (plus
+ * the best run and the coefficient of variation, to judge noise).
+ */
+namespace bench {
+
+class State {
+public:
+    State(int64_t argument, uint64_t iterations)
+        : argument(argument), remaining(iterations), total(iterations), itemsPerIteration(0) {}
+
+    // True while the timed loop should continue; the clock starts on the
+    // first call so setup before the loop is not measured
+    bool keepRunning() {
+        if (remaining == total) start = std::chrono::steady_clock::now();
+        if (remaining == 0) {
+            stop = std::chrono::steady_clock::now();
+            return false;
+        }
+        remaining--;
+        return true;
+    }
+
+    int64_t arg() const { return argument; }
+    uint64_t iterations() const { return total; }
+
+    // States (or other work items) per iteration, reported as states/s
+    void setItemsPerIteration(uint64_t items) { itemsPerIteration = items; }
+    uint64_t getItemsPerIteration() const { return itemsPerIteration; }
+
+    double elapsedSeconds() const { return std::chrono::duration<double>(stop - start).count(); }
+
+private:
+    int64_t argument;
+    uint64_t remaining;
+    uint64_t total;
+    uint64_t itemsPerIteration;
+    std::chrono::steady_clock::time_point start;
+    std::chrono::steady_clock::time_point stop;
+};
+
+// Keep the compiler from discarding a result
+template <typename T>
+inline void doNotOptimize(const T& value) {
+#if defined(__GNUC__) || defined(__clang__)
+    asm volatile("" : : "r,m"(value) : "memory");
+#else
+    static volatile const void* sink;
+    sink = &value;
+#endif
+}
+
+using Function = std::function<void(State&)>;
+
+// Registers one benchmark per argument (no arguments: a single run with 0)
+bool registerBenchmark(const std::string& name, Function function, std::vector<int64_t> arguments);
+
+// Parse flags (--filter=, --min-time=, --repetitions=, --csv=) and run
+int runAll(int argc, char** argv);
+
+} // namespace bench
+
+#define MDV_BENCHMARK(function) \
+    static const bool function##_registered = \
+        bench::registerBenchmark(#function, function, std::vector<int64_t>())
+
+#define MDV_BENCHMARK_ARGS(function, ...) \
+    static const bool function##_registered = \
+        bench::registerBenchmark(#function, function, std::vector<int64_t>{__VA_ARGS__})
+
+#endif // BENCHMARK_H
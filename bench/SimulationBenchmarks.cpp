@@ -0,0 +1,294 @@
+#include "Benchmark.h"
+#include "CompactTrajectory.h"
+#include "Constants.h"
+#include "Integrator.h"
+#include "OrbitPropagator.h"
+#include "OrbitPresets.h"
+#include "OrbitalElements.h"
+#include "KeplerSolver.h"
+#include "GroundStation.h"
+#include "GroundTrack.h"
+#include "Eclipse.h"
+#include "PolylineSimplifier.h"
+#include "FuzzyNameIndex.h"
+#include "MonteCarlo.h"
+#include <cstdio>
+
+// All inputs are fixed presets so runs are comparable across builds
+namespace {
+    const OrbitPreset& issPreset() {
+        static const OrbitPreset preset = OrbitPresets::createPreset(ORBIT_ISS, MU_EARTH);
+        return preset;
+    }
+
+    // One ISS orbit at the visualizer's sampling
+    const std::vector<StateVector>& issOrbit() {
+        static const std::vector<StateVector> orbit = [] {
+            OrbitPropagator propagator(MU_EARTH);
+            const OrbitPreset& preset = issPreset();
+            return propagator.propagate(preset.initialState, preset.period,
+                                        preset.period / ORBIT_SAMPLES_PER_PERIOD);
+        }();
+        return orbit;
+    }
+
+    // One day of ISS states at 30 s
+    const std::vector<StateVector>& issDay() {
+        static const std::vector<StateVector> day = [] {
+            OrbitPropagator propagator(MU_EARTH);
+            return propagator.propagate(issPreset().initialState, 86400.0, 30.0);
+        }();
+        return day;
+    }
+
+    void runRK4Step(bench::State& state, bool j2) {
+        RK4Integrator integrator;
+        ForceModel forces;
+        forces.j2Perturbation = j2;
+
+        StateVector current = issPreset().initialState;
+        while (state.keepRunning()) {
+            current = integrator.step(current, 10.0, MU_EARTH, forces);
+            bench::doNotOptimize(current);
+        }
+        state.setItemsPerIteration(1);
+    }
+}
+
+static void BM_RK4Step_PointMass(bench::State& state) {
+    runRK4Step(state, false);
+}
+MDV_BENCHMARK(BM_RK4Step_PointMass);
+
+static void BM_RK4Step_J2(bench::State& state) {
+    runRK4Step(state, true);
+}
+MDV_BENCHMARK(BM_RK4Step_J2);
+
+// Argument: span in ISS orbits, 60 s step
+static void BM_Propagate(bench::State& state) {
+    OrbitPropagator propagator(MU_EARTH);
+    const OrbitPreset& preset = issPreset();
+    double span = preset.period * state.arg();
+
+    size_t states = 0;
+    while (state.keepRunning()) {
+        std::vector<StateVector> trajectory = propagator.propagate(preset.initialState, span, 60.0);
+        states = trajectory.size();
+        bench::doNotOptimize(trajectory.data());
+    }
+    state.setItemsPerIteration(states);
+}
+MDV_BENCHMARK_ARGS(BM_Propagate, 1, 10, 100);
+
+// One ISS orbit with the state transition matrix, 60 s step
+// (central finite differences would cost 13x BM_Propagate/1)
+static void BM_PropagateTransition(bench::State& state) {
+    OrbitPropagator propagator(MU_EARTH);
+    const OrbitPreset& preset = issPreset();
+
+    std::vector<StateTransitionMatrix> transitions;
+    size_t states = 0;
+    while (state.keepRunning()) {
+        std::vector<StateVector> trajectory =
+            propagator.propagateWithTransition(preset.initialState, preset.period, 60.0, transitions);
+        states = trajectory.size();
+        bench::doNotOptimize(transitions.data());
+    }
+    state.setItemsPerIteration(states);
+}
+MDV_BENCHMARK(BM_PropagateTransition);
+
+// Argument: ensemble size; one ISS orbit with J2 at 60 s, all cores
+static void BM_MonteCarlo(bench::State& state) {
+    static MonteCarloPropagator ensemble(MU_EARTH);
+    ForceModel forces;
+    forces.j2Perturbation = true;
+    ensemble.setForceModel(forces);
+
+    MonteCarloSettings settings;
+    settings.members = static_cast<size_t>(state.arg());
+    settings.duration = issPreset().period;
+    settings.timestep = 60.0;
+    settings.outputInterval = 10;
+
+    while (state.keepRunning()) {
+        MonteCarloResult result = ensemble.run(issPreset().initialState, settings);
+        bench::doNotOptimize(result.epochs.data());
+    }
+    state.setItemsPerIteration(settings.members);
+}
+MDV_BENCHMARK_ARGS(BM_MonteCarlo, 1000, 10000);
+
+static void BM_AccessWindows(bench::State& state) {
+    const std::vector<StateVector>& day = issDay();
+    GroundStation station = GroundStationPresets::createStation(GroundStationPresets::NASA_JPL);
+
+    while (state.keepRunning()) {
+        AccessStatistics stats = GroundStationAccess::calculateAccessWindows(day, station, EARTH_RADIUS);
+        bench::doNotOptimize(stats.totalAccessTime);
+    }
+    state.setItemsPerIteration(day.size());
+}
+MDV_BENCHMARK(BM_AccessWindows);
+
+static void BM_CheckEclipse(bench::State& state) {
+    const std::vector<StateVector>& orbit = issOrbit();
+    Vector3D sunDirection(1.0, 0.0, 0.0);
+
+    size_t i = 0;
+    while (state.keepRunning()) {
+        EclipseStatus status = EclipseDetector::checkEclipse(orbit[i].position, sunDirection, EARTH_RADIUS);
+        bench::doNotOptimize(status);
+        if (++i == orbit.size()) i = 0;
+    }
+    state.setItemsPerIteration(1);
+}
+MDV_BENCHMARK(BM_CheckEclipse);
+
+static void BM_GroundTrack(bench::State& state) {
+    const std::vector<StateVector>& orbit = issOrbit();
+
+    while (state.keepRunning()) {
+        std::vector<GeoCoordinate> track = GroundTrack::calculateGroundTrack(orbit);
+        bench::doNotOptimize(track.data());
+    }
+    state.setItemsPerIteration(orbit.size());
+}
+MDV_BENCHMARK(BM_GroundTrack);
+
+// Argument: 0 = Float32, 1 = Delta16 (the trajectory cache's format)
+static void BM_CompactEncode(bench::State& state) {
+    const std::vector<StateVector>& day = issDay();
+    TrajectoryEncoding encoding = state.arg() ? TrajectoryEncoding::Delta16 : TrajectoryEncoding::Float32;
+
+    while (state.keepRunning()) {
+        CompactTrajectory compact = CompactTrajectory::encode(day, encoding);
+        bench::doNotOptimize(compact.size());
+    }
+    state.setItemsPerIteration(day.size());
+}
+MDV_BENCHMARK_ARGS(BM_CompactEncode, 0, 1);
+
+// Full decode of a trajectory
+static void BM_CompactDecode(bench::State& state) {
+    const std::vector<StateVector>& day = issDay();
+    TrajectoryEncoding encoding = state.arg() ? TrajectoryEncoding::Delta16 : TrajectoryEncoding::Float32;
+    CompactTrajectory compact = CompactTrajectory::encode(day, encoding);
+
+    while (state.keepRunning()) {
+        std::vector<StateVector> decoded = compact.decode();
+        bench::doNotOptimize(decoded.data());
+    }
+    state.setItemsPerIteration(day.size());
+}
+MDV_BENCHMARK_ARGS(BM_CompactDecode, 0, 1);
+
+static void BM_ElementsFromState(bench::State& state) {
+    const std::vector<StateVector>& orbit = issOrbit();
+
+    size_t i = 0;
+    while (state.keepRunning()) {
+        OrbitalElements elements = OrbitalElements::fromStateVector(orbit[i], MU_EARTH);
+        bench::doNotOptimize(elements);
+        if (++i == orbit.size()) i = 0;
+    }
+    state.setItemsPerIteration(1);
+}
+MDV_BENCHMARK(BM_ElementsFromState);
+
+// Whole-trajectory conversion, as done by Satellite::getElementHistory
+static void BM_ElementsFromStates(bench::State& state) {
+    const std::vector<StateVector>& day = issDay();
+
+    while (state.keepRunning()) {
+        std::vector<OrbitalElements> elements = OrbitalElements::fromStateVectors(day, MU_EARTH);
+        bench::doNotOptimize(elements);
+    }
+    state.setItemsPerIteration(day.size());
+}
+MDV_BENCHMARK(BM_ElementsFromStates);
+
+// Argument: batch size, eccentricities spread over [0, 0.9]
+static void BM_KeplerBatch(bench::State& state) {
+    size_t count = static_cast<size_t>(state.arg());
+    std::vector<double> mean(count), ecc(count), anomaly(count);
+    for (size_t k = 0; k < count; k++) {
+        mean[k] = 0.37 * k;
+        ecc[k] = 0.9 * (k % 97) / 96.0;
+    }
+
+    while (state.keepRunning()) {
+        KeplerSolver::solveElliptic(mean.data(), ecc.data(), anomaly.data(), count);
+        bench::doNotOptimize(anomaly);
+    }
+    state.setItemsPerIteration(count);
+}
+MDV_BENCHMARK_ARGS(BM_KeplerBatch, 1024, 65536);
+
+// Argument: batch size, eccentricities spread over [1.05, 5]
+static void BM_KeplerHyperbolicBatch(bench::State& state) {
+    size_t count = static_cast<size_t>(state.arg());
+    std::vector<double> mean(count), ecc(count), anomaly(count);
+    for (size_t k = 0; k < count; k++) {
+        mean[k] = 0.37 * (k % 101) - 18.5;
+        ecc[k] = 1.05 + 3.95 * (k % 97) / 96.0;
+    }
+
+    while (state.keepRunning()) {
+        KeplerSolver::solveHyperbolic(mean.data(), ecc.data(), anomaly.data(), count);
+        bench::doNotOptimize(anomaly);
+    }
+    state.setItemsPerIteration(count);
+}
+MDV_BENCHMARK_ARGS(BM_KeplerHyperbolicBatch, 1024, 65536);
+
+// One Molniya orbit from elements, one state per minute
+static void BM_ElementsToStates(bench::State& state) {
+    OrbitPreset preset = OrbitPresets::createPreset(ORBIT_MOLNIYA, MU_EARTH);
+    OrbitalElements elements = OrbitalElements::fromStateVector(preset.initialState, MU_EARTH);
+    std::vector<double> times;
+    for (double t = 0.0; t < preset.period; t += 60.0) times.push_back(t);
+
+    while (state.keepRunning()) {
+        std::vector<StateVector> states = elements.toStateVectors(times, MU_EARTH);
+        bench::doNotOptimize(states);
+    }
+    state.setItemsPerIteration(times.size());
+}
+MDV_BENCHMARK(BM_ElementsToStates);
+
+// Orbit line LOD ranking (run once per uploaded trajectory)
+static void BM_PolylineImportance(bench::State& state) {
+    const std::vector<StateVector>& day = issDay();
+
+    while (state.keepRunning()) {
+        std::vector<double> rank = PolylineSimplifier::importance(day);
+        bench::doNotOptimize(rank.data());
+    }
+    state.setItemsPerIteration(day.size());
+}
+MDV_BENCHMARK(BM_PolylineImportance);
+
+// Typing "star 12" into a catalog-sized satellite list, one key at a time
+static void BM_FuzzySearch(bench::State& state) {
+    static const char* prefixes[] = {"STARLINK-", "COSMOS ", "IRIDIUM ", "ONEWEB-", "GPS BIIR-", "NOAA "};
+    std::vector<std::string> names(30000);
+    char buffer[32];
+    for (size_t i = 0; i < names.size(); i++) {
+        snprintf(buffer, sizeof(buffer), "%s%zu", prefixes[i % 6], 1000 + i * 7 % 9000);
+        names[i] = buffer;
+    }
+
+    FuzzyNameIndex index;
+    index.build(names);
+    const std::string query = "star 12";
+
+    while (state.keepRunning()) {
+        for (size_t length = 0; length <= query.size(); length++) {
+            bench::doNotOptimize(index.search(query.substr(0, length)).data());
+        }
+    }
+    state.setItemsPerIteration(names.size());
+}
+MDV_BENCHMARK(BM_FuzzySearch);
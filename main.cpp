@@ -13,11 +13,20 @@
 #include "EarthRenderer.h"
 #include "GridRenderer.h"
 #include "OrbitRenderer.h"
+#include "SphereBatch.h"
+#include "OrbitLineCache.h"
+#include "ViewCuller.h"
 #include "CameraController.h"
 #include "FontSystem.h"
 #include "UIManager.h"
 #include "InputHandler.h"
 #include "RenderUtils.h"
+#include "SimulationWorker.h"
+#include "BackgroundPropagator.h"
+#include "TrajectoryCache.h"
+#include "Profiler.h"
+#include <cstdio>
+#include <string>
 #include <vector>
 #include <iostream>
 
@@ -42,12 +51,22 @@ int main()
     EarthRenderer earth;
     earth.load();
 
+    SphereBatch satelliteSpheres;
+    satelliteSpheres.load();
+
+    OrbitLineCache orbitLines;
+    orbitLines.load();
+
+    ViewCuller viewCuller;
+
     CameraController cameraController;
     cameraController.initialize();
 
     UIManager ui(screenWidth, screenHeight);
     InputHandler input;
 
+    Profiler::setThreadName("Main");
+
     // Sun direction (fixed along +X axis for now)
     Vector3D sunDirection(1.0, 0.0, 0.0);
 
@@ -57,18 +76,64 @@ int main()
     // Get force model reference for UI control
     ForceModel &forceModel = propagator.getForceModel();
 
-    // Generate all preset orbits
+    // Initialize ground stations (access windows are cached with the orbits)
+    std::vector<GroundStation> groundStations = GroundStationPresets::getAllStations();
+
+    // Load orbits and access windows from the cache, propagating on a miss
+    TrajectoryCache trajectoryCache(TRAJECTORY_CACHE_DIR);
     std::vector<OrbitPreset> presets = OrbitPresets::getAllPresets(MU_EARTH);
     std::vector<Satellite> satellites;
+    std::vector<std::vector<AccessStatistics>> allAccessStats;
 
     std::cout << "Generating orbits...\n";
+    size_t denseBytes = 0;
+    size_t compactBytes = 0;
     for (const auto &preset : presets)
     {
-        double timestep = preset.period / 360.0;
-        auto trajectory = propagator.propagate(preset.initialState, preset.period, timestep);
-        satellites.push_back(Satellite(preset, trajectory));
-        std::cout << "  " << preset.name << ": " << trajectory.size() << " points\n";
+        double timestep = preset.period / ORBIT_SAMPLES_PER_PERIOD;
+        std::string key = TrajectoryCache::makeKey(
+            preset.initialState, preset.period, timestep, MU_EARTH,
+            forceModel, propagator.getIntegrator().name(), groundStations);
+
+        // Satellites keep the compact trajectory; a cached one is read in
+        // place from the mapped file
+        CachedTrajectory cached;
+        std::shared_ptr<const CompactTrajectory> trajectory;
+        std::vector<AccessStatistics> satStats;
+        bool fromCache = trajectoryCache.open(key, cached);
+
+        if (fromCache)
+        {
+            trajectory = cached.getTrajectory();
+            satStats = cached.accessStatistics();
+        }
+        else
+        {
+            std::vector<StateVector> states = propagator.propagate(preset.initialState, preset.period, timestep);
+            for (const auto &station : groundStations)
+            {
+                satStats.push_back(
+                    GroundStationAccess::calculateAccessWindows(
+                        states, station, EARTH_RADIUS));
+            }
+            trajectory = std::make_shared<const CompactTrajectory>(CompactTrajectory::encode(states));
+            trajectoryCache.store(key, *trajectory, satStats);
+        }
+
+        std::cout << "  " << preset.name << ": " << trajectory->size() << " points"
+                  << (fromCache ? " (cached)" : "") << "\n";
+        denseBytes += trajectory->size() * sizeof(StateVector);
+        compactBytes += trajectory->memoryBytes();
+        satellites.push_back(Satellite(preset, std::move(trajectory)));
+        allAccessStats.push_back(std::move(satStats));
     }
+    std::cout << "  Access windows ready for " << satellites.size()
+              << " satellites and " << groundStations.size() << " stations\n";
+
+    char memoryLine[128];
+    std::snprintf(memoryLine, sizeof(memoryLine), "  Trajectories: %.1f KB in memory, %.1fx smaller than dense\n",
+                  compactBytes / 1024.0, compactBytes ? static_cast<double>(denseBytes) / compactBytes : 0.0);
+    std::cout << memoryLine;
 
     // Start with all satellites hidden
     for (auto &sat : satellites)
@@ -80,32 +145,20 @@ int main()
         satellites[0].setVisible(true);
     }
 
-    // Initialize ground stations
-    std::vector<GroundStation> groundStations = GroundStationPresets::getAllStations();
-
-    std::cout << "Calculating ground station access windows...\n";
-    // Pre-calculate access statistics for all satellites
-    std::vector<std::vector<AccessStatistics>> allAccessStats;
-    for (const auto &satellite : satellites)
-    {
-        std::vector<AccessStatistics> satStats;
-        for (const auto &station : groundStations)
-        {
-            satStats.push_back(
-                GroundStationAccess::calculateAccessWindows(
-                    satellite.getOrbit(), station, EARTH_RADIUS));
-        }
-        allAccessStats.push_back(satStats);
-    }
-    std::cout << "  Access windows calculated for " << satellites.size()
-              << " satellites and " << groundStations.size() << " stations\n";
-
     // Simulation state
     size_t activeSatelliteIndex = 0;
     float animationSpeed = 1.0f;
     bool showGrids = true;
     bool earthRotation = true;
 
+    // Start the background simulation thread
+    SimulationWorker simulation;
+    simulation.start(satellites, sunDirection);
+
+    // Re-propagates all orbits in the background when the force model changes
+    BackgroundPropagator repropagator(MU_EARTH);
+    repropagator.setCache(&trajectoryCache);
+
     std::cout << "\nVisualization ready!\n";
     std::cout << "Controls:\n";
     std::cout << "  SPACE: Pause/Resume\n";
@@ -116,12 +169,16 @@ int main()
     std::cout << "  V: Toggle eclipse visualization\n";
     std::cout << "  Y: Toggle solar panel analysis\n";
     std::cout << "  R: Toggle Earth rotation\n";
+    std::cout << "  P: Toggle profiler overlay (F3 saves a trace)\n";
 
     // Main loop
     while (!WindowShouldClose())
     {
         float deltaTime = GetFrameTime();
 
+        // Fold last frame's profiler events into the overlay statistics
+        Profiler::collectFrame();
+
         // Process input
         input.processInput(
             satellites,
@@ -133,6 +190,55 @@ int main()
             earthRotation,
             forceModel);
 
+        // Force model toggled: recompute trajectories off the main thread
+        // (a newer toggle cancels the run still in flight)
+        if (input.consumeForceModelChange())
+        {
+            repropagator.request(presets, forceModel, groundStations);
+        }
+
+        if (input.consumeTraceExportRequest())
+        {
+            if (Profiler::exportChromeTrace(PROFILE_TRACE_PATH))
+            {
+                std::cout << "Profiler trace written to " << PROFILE_TRACE_PATH << "\n";
+            }
+            else
+            {
+                std::cerr << "Failed to write " << PROFILE_TRACE_PATH << "\n";
+            }
+        }
+
+        // Stream finished trajectories into the scene as they complete
+        for (auto &result : repropagator.collectResults())
+        {
+            satellites[result.satelliteIndex].setOrbit(result.trajectory);
+            simulation.setTrajectory(result.satelliteIndex, result.trajectory);
+            allAccessStats[result.satelliteIndex] = std::move(result.accessStats);
+
+            // New statistics may move the satellite to another orbit family
+            ui.getSatelliteList().invalidate();
+        }
+        ui.setPropagationProgress(repropagator.completedCount(), repropagator.totalCount());
+        MDV_PROFILE_COUNTER("Pending orbits", repropagator.totalCount() - repropagator.completedCount());
+
+        // Forward controls to the simulation thread
+        simulation.setAnimationSpeed(animationSpeed);
+        size_t visibleCount = 0;
+        for (size_t i = 0; i < satellites.size(); i++)
+        {
+            simulation.setSatelliteVisible(i, satellites[i].isVisible());
+            visibleCount += satellites[i].isVisible() ? 1 : 0;
+        }
+        MDV_PROFILE_COUNTER("Visible satellites", visibleCount);
+
+        // Pick up the newest simulation snapshot (never blocks)
+        const SimulationSnapshot &snapshot = simulation.latestSnapshot();
+        for (size_t i = 0; i < satellites.size() && i < snapshot.frames.size(); i++)
+        {
+            satellites[i].setCurrentFrame(snapshot.frames[i]);
+        }
+
         // Update Earth rotation state
         earth.setRotationEnabled(earthRotation);
 
@@ -147,26 +253,11 @@ int main()
         cameraController.update(deltaTime, satellites, activeSatelliteIndex);
         cameraController.handleManualControls();
 
-        // Advance satellite animations
-        if (animationSpeed > 0.01f)
-        {
-            size_t framesToAdvance = static_cast<size_t>(animationSpeed);
-            if (framesToAdvance < 1)
-                framesToAdvance = 1;
-
-            for (auto &sat : satellites)
-            {
-                sat.advanceFrames(framesToAdvance);
-            }
-        }
-
-        // Get current orbital elements for active satellite
+        // Osculating elements of the active satellite's current state
         OrbitalElements currentElements;
         if (activeSatelliteIndex < satellites.size())
         {
-            currentElements = OrbitalElements::fromStateVector(
-                satellites[activeSatelliteIndex].getCurrentState(),
-                MU_EARTH);
+            currentElements = satellites[activeSatelliteIndex].getCurrentElements();
         }
 
         // Rendering
@@ -174,57 +265,70 @@ int main()
         ClearBackground(Color{15, 23, 42, 255}); // UITheme::BG_DARK
 
         // 3D rendering
-        BeginMode3D(cameraController.getCamera());
+        {
+            MDV_PROFILE_SCOPE("Render3D");
+            BeginMode3D(cameraController.getCamera());
+            viewCuller.update();
 
-        earth.draw();
+            earth.draw();
 
-        if (showGrids)
-        {
-            GridRenderer::drawEquatorialGrid();
-            GridRenderer::drawReferenceCircles();
-        }
+            if (showGrids)
+            {
+                GridRenderer::drawEquatorialGrid();
+                GridRenderer::drawReferenceCircles();
+            }
 
-        OrbitRenderer::drawSatellites(
-            satellites,
-            activeSatelliteIndex,
-            sunDirection,
-            ui.isShowingEclipse());
+            OrbitRenderer::drawSatellites(
+                satellites,
+                activeSatelliteIndex,
+                snapshot.eclipse,
+                ui.isShowingEclipse(),
+                satelliteSpheres,
+                orbitLines,
+                viewCuller);
+
+            // Draw sun vector for active satellite (if solar analysis is shown)
+            if (ui.isShowingSolar() && activeSatelliteIndex < satellites.size())
+            {
+                Vector3 satPos = RenderUtils::toRaylib(
+                    satellites[activeSatelliteIndex].getCurrentState().position);
+                Vector3D sunDirScaled = sunDirection.normalized() * 5000.0;
+                Vector3 sunEnd = RenderUtils::toRaylib(
+                    satellites[activeSatelliteIndex].getCurrentState().position + sunDirScaled);
+                DrawLine3D(satPos, sunEnd, Color{245, 158, 11, 255}); // UITheme::WARNING (yellow)
+            }
 
-        // Draw sun vector for active satellite (if solar analysis is shown)
-        if (ui.isShowingSolar() && activeSatelliteIndex < satellites.size())
-        {
-            Vector3 satPos = RenderUtils::toRaylib(
-                satellites[activeSatelliteIndex].getCurrentState().position);
-            Vector3D sunDirScaled = sunDirection.normalized() * 5000.0;
-            Vector3 sunEnd = RenderUtils::toRaylib(
-                satellites[activeSatelliteIndex].getCurrentState().position + sunDirScaled);
-            DrawLine3D(satPos, sunEnd, Color{245, 158, 11, 255}); // UITheme::WARNING (yellow)
+            EndMode3D();
         }
 
-        EndMode3D();
-
         // 2D UI overlay
-        ui.draw(
-            fonts,
-            satellites,
-            activeSatelliteIndex,
-            currentElements,
-            animationSpeed,
-            showGrids,
-            earthRotation,
-            cameraController.isFollowModeEnabled(),
-            GetFPS(),
-            sunDirection,
-            groundStations,
-            allAccessStats[activeSatelliteIndex],
-            forceModel),
-            
+        {
+            MDV_PROFILE_SCOPE("UIDraw");
+            ui.draw(
+                fonts,
+                satellites,
+                activeSatelliteIndex,
+                currentElements,
+                animationSpeed,
+                showGrids,
+                earthRotation,
+                cameraController.isFollowModeEnabled(),
+                GetFPS(),
+                sunDirection,
+                groundStations,
+                allAccessStats[activeSatelliteIndex],
+                forceModel);
+        }
 
         EndDrawing();
     }
 
     // Cleanup
+    simulation.stop();
     fonts.unload();
+    ui.unload();
+    satelliteSpheres.unload();
+    orbitLines.unload();
     earth.unload();
     CloseWindow();
 
@@ -0,0 +1,297 @@
+#include "ChebyshevEphemeris.h"
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+
+namespace {
+    const char FILE_MAGIC[8] = {'M', 'D', 'V', 'C', 'H', 'E', 'B', '\0'};
+    const uint32_t FILE_VERSION = 2;
+
+    // Chebyshev polynomials and their derivatives at x, k = 0..degree
+    void chebyshevBasis(double x, int degree, double* T, double* dT) {
+        T[0] = 1.0;
+        dT[0] = 0.0;
+        if (degree == 0) return;
+        T[1] = x;
+        dT[1] = 1.0;
+        for (int k = 1; k < degree; k++) {
+            T[k + 1] = 2.0 * x * T[k] - T[k - 1];
+            dT[k + 1] = 2.0 * T[k] + 2.0 * x * dT[k] - dT[k - 1];
+        }
+    }
+
+    // Solve the least-squares problem min |A c - B| for three right-hand
+    // sides with Householder QR (A is rows x cols, row-major; overwritten).
+    // Normal equations would square the condition number of the
+    // derivative rows, which grow like k^2.
+    void solveLeastSquares(std::vector<double>& A, std::vector<double>& B,
+                           size_t rows, size_t cols, double* solution) {
+        for (size_t j = 0; j < cols; j++) {
+            double norm = 0.0;
+            for (size_t i = j; i < rows; i++) norm += A[i * cols + j] * A[i * cols + j];
+            norm = std::sqrt(norm);
+            if (norm == 0.0) continue;
+
+            double alpha = (A[j * cols + j] > 0.0) ? -norm : norm;
+            A[j * cols + j] -= alpha;
+
+            double vnorm2 = 0.0;
+            for (size_t i = j; i < rows; i++) vnorm2 += A[i * cols + j] * A[i * cols + j];
+
+            // Reflect the remaining columns and the right-hand sides
+            for (size_t k = j + 1; k < cols; k++) {
+                double dot = 0.0;
+                for (size_t i = j; i < rows; i++) dot += A[i * cols + j] * A[i * cols + k];
+                double f = 2.0 * dot / vnorm2;
+                for (size_t i = j; i < rows; i++) A[i * cols + k] -= f * A[i * cols + j];
+            }
+            for (int c = 0; c < 3; c++) {
+                double dot = 0.0;
+                for (size_t i = j; i < rows; i++) dot += A[i * cols + j] * B[i * 3 + c];
+                double f = 2.0 * dot / vnorm2;
+                for (size_t i = j; i < rows; i++) B[i * 3 + c] -= f * A[i * cols + j];
+            }
+
+            A[j * cols + j] = alpha;
+        }
+
+        // Back substitution on R
+        for (int c = 0; c < 3; c++) {
+            for (size_t jj = cols; jj-- > 0;) {
+                double sum = B[jj * 3 + c];
+                for (size_t k = jj + 1; k < cols; k++) {
+                    sum -= A[jj * cols + k] * solution[k * 3 + c];
+                }
+                solution[jj * 3 + c] = (A[jj * cols + jj] != 0.0) ? sum / A[jj * cols + jj] : 0.0;
+            }
+        }
+    }
+}
+
+ChebyshevEphemeris::ChebyshevEphemeris()
+    : degree(DEFAULT_DEGREE), tolerance(DEFAULT_TOLERANCE), positionError(0.0), velocityError(0.0) {}
+
+ChebyshevEphemeris ChebyshevEphemeris::fit(
+    const std::vector<StateVector>& trajectory,
+    int degree,
+    double tolerance
+) {
+    ChebyshevEphemeris ephemeris;
+    ephemeris.tolerance = tolerance;
+    size_t n = trajectory.size();
+    if (n < 2) return ephemeris;
+
+    // Each sample gives two equations (position and velocity)
+    ephemeris.degree = std::max(1, std::min(degree, static_cast<int>(2 * n) - 1));
+    size_t minSamples = static_cast<size_t>(ephemeris.degree + 2) / 2;
+
+    // Depth-first bisection keeps segments in time order
+    std::vector<std::pair<size_t, size_t>> pending;
+    pending.push_back({0, n - 1});
+    while (!pending.empty()) {
+        std::pair<size_t, size_t> range = pending.back();
+        pending.pop_back();
+
+        // Too short to split: keep the fit, its error shows in withinTolerance()
+        size_t samples = range.second - range.first + 1;
+        bool canSplit = samples >= 2 * minSamples;
+        if (ephemeris.fitSegment(trajectory, range.first, range.second, canSplit ? tolerance : INFINITY)) {
+            continue;
+        }
+
+        size_t mid = range.first + (range.second - range.first) / 2;
+        pending.push_back({mid, range.second});
+        pending.push_back({range.first, mid});
+    }
+
+    return ephemeris;
+}
+
+bool ChebyshevEphemeris::fitSegment(
+    const std::vector<StateVector>& trajectory,
+    size_t first, size_t last, double tolerance
+) {
+    double start = trajectory[first].time;
+    double end = trajectory[last].time;
+    double mid = 0.5 * (start + end);
+    double half = 0.5 * (end - start);
+    if (half <= 0.0) return true;
+
+    size_t cols = static_cast<size_t>(degree) + 1;
+    size_t samples = last - first + 1;
+    size_t rows = 2 * samples;
+
+    std::vector<double> A(rows * cols);
+    std::vector<double> B(rows * 3);
+    std::vector<double> T(cols), dT(cols);
+
+    for (size_t s = 0; s < samples; s++) {
+        const StateVector& state = trajectory[first + s];
+        chebyshevBasis((state.time - mid) / half, degree, T.data(), dT.data());
+
+        // Velocity rows are scaled to position units: dp/dx = v * half
+        size_t pr = 2 * s;
+        size_t vr = 2 * s + 1;
+        for (size_t k = 0; k < cols; k++) {
+            A[pr * cols + k] = T[k];
+            A[vr * cols + k] = dT[k];
+        }
+        B[pr * 3 + 0] = state.position.x;
+        B[pr * 3 + 1] = state.position.y;
+        B[pr * 3 + 2] = state.position.z;
+        B[vr * 3 + 0] = state.velocity.x * half;
+        B[vr * 3 + 1] = state.velocity.y * half;
+        B[vr * 3 + 2] = state.velocity.z * half;
+    }
+
+    std::vector<double> solution(cols * 3);
+    solveLeastSquares(A, B, rows, cols, solution.data());
+
+    // Check the fit on every input sample
+    double segPosError = 0.0;
+    double segVelError = 0.0;
+    for (size_t s = 0; s < samples; s++) {
+        const StateVector& state = trajectory[first + s];
+        chebyshevBasis((state.time - mid) / half, degree, T.data(), dT.data());
+
+        Vector3D p, v;
+        for (size_t k = 0; k < cols; k++) {
+            p = p + Vector3D(solution[k * 3], solution[k * 3 + 1], solution[k * 3 + 2]) * T[k];
+            v = v + Vector3D(solution[k * 3], solution[k * 3 + 1], solution[k * 3 + 2]) * dT[k];
+        }
+        v = v / half;
+
+        segPosError = std::max(segPosError, (p - state.position).magnitude());
+        segVelError = std::max(segVelError, (v - state.velocity).magnitude());
+    }
+
+    if (segPosError > tolerance) return false;
+
+    segments.push_back({start, end});
+    for (int c = 0; c < 3; c++) {
+        for (size_t k = 0; k < cols; k++) {
+            coefficients.push_back(solution[k * 3 + c]);
+        }
+    }
+    positionError = std::max(positionError, segPosError);
+    velocityError = std::max(velocityError, segVelError);
+    return true;
+}
+
+size_t ChebyshevEphemeris::findSegment(double t) const {
+    auto it = std::upper_bound(segments.begin(), segments.end(), t,
+        [](double time, const Segment& seg) { return time < seg.start; });
+    if (it == segments.begin()) return 0;
+    return static_cast<size_t>(it - segments.begin()) - 1;
+}
+
+StateVector ChebyshevEphemeris::evaluate(double t) const {
+    if (segments.empty()) return StateVector();
+
+    t = std::max(startTime(), std::min(endTime(), t));
+    size_t index = findSegment(t);
+    const Segment& seg = segments[index];
+
+    double mid = 0.5 * (seg.start + seg.end);
+    double half = 0.5 * (seg.end - seg.start);
+    double x = (t - mid) / half;
+
+    size_t cols = static_cast<size_t>(degree) + 1;
+    const double* cx = &coefficients[index * 3 * cols];
+    const double* cy = cx + cols;
+    const double* cz = cy + cols;
+
+    // Walk the basis once for all six outputs
+    double px = cx[0], py = cy[0], pz = cz[0];
+    double vx = 0.0, vy = 0.0, vz = 0.0;
+    double T0 = 1.0, T1 = x;
+    double dT0 = 0.0, dT1 = 1.0;
+    for (size_t k = 1; k < cols; k++) {
+        px += cx[k] * T1;  py += cy[k] * T1;  pz += cz[k] * T1;
+        vx += cx[k] * dT1; vy += cy[k] * dT1; vz += cz[k] * dT1;
+
+        double T2 = 2.0 * x * T1 - T0;
+        double dT2 = 2.0 * T1 + 2.0 * x * dT1 - dT0;
+        T0 = T1;   T1 = T2;
+        dT0 = dT1; dT1 = dT2;
+    }
+
+    double inv = 1.0 / half;
+    return StateVector(Vector3D(px, py, pz), Vector3D(vx * inv, vy * inv, vz * inv), t);
+}
+
+size_t ChebyshevEphemeris::memoryBytes() const {
+    return segments.capacity() * sizeof(Segment) + coefficients.capacity() * sizeof(double);
+}
+
+bool ChebyshevEphemeris::save(const std::string& path) const {
+    std::ofstream file(path, std::ios::binary);
+    if (!file) return false;
+
+    // Header: magic, version, degree, segment count, tolerance, fit errors
+    int32_t deg = degree;
+    uint64_t count = segments.size();
+    file.write(FILE_MAGIC, sizeof(FILE_MAGIC));
+    file.write(reinterpret_cast<const char*>(&FILE_VERSION), sizeof(FILE_VERSION));
+    file.write(reinterpret_cast<const char*>(&deg), sizeof(deg));
+    file.write(reinterpret_cast<const char*>(&count), sizeof(count));
+    file.write(reinterpret_cast<const char*>(&tolerance), sizeof(tolerance));
+    file.write(reinterpret_cast<const char*>(&positionError), sizeof(positionError));
+    file.write(reinterpret_cast<const char*>(&velocityError), sizeof(velocityError));
+
+    // Body: segment bounds, then all coefficients
+    file.write(reinterpret_cast<const char*>(segments.data()), segments.size() * sizeof(Segment));
+    file.write(reinterpret_cast<const char*>(coefficients.data()), coefficients.size() * sizeof(double));
+
+    return static_cast<bool>(file);
+}
+
+bool ChebyshevEphemeris::load(const std::string& path, ChebyshevEphemeris& out) {
+    std::ifstream file(path, std::ios::binary);
+    if (!file) return false;
+
+    char magic[sizeof(FILE_MAGIC)];
+    uint32_t version = 0;
+    int32_t deg = 0;
+    uint64_t count = 0;
+    ChebyshevEphemeris ephemeris;
+
+    file.read(magic, sizeof(magic));
+    file.read(reinterpret_cast<char*>(&version), sizeof(version));
+    file.read(reinterpret_cast<char*>(&deg), sizeof(deg));
+    file.read(reinterpret_cast<char*>(&count), sizeof(count));
+    file.read(reinterpret_cast<char*>(&ephemeris.tolerance), sizeof(ephemeris.tolerance));
+    file.read(reinterpret_cast<char*>(&ephemeris.positionError), sizeof(ephemeris.positionError));
+    file.read(reinterpret_cast<char*>(&ephemeris.velocityError), sizeof(ephemeris.velocityError));
+
+    if (!file || std::memcmp(magic, FILE_MAGIC, sizeof(FILE_MAGIC)) != 0 ||
+        version != FILE_VERSION || deg < 1 || deg > 64 || count > (1ull << 32)) {
+        return false;
+    }
+
+    // The body must actually be there before anything is allocated for it,
+    // so a corrupt count fails here instead of in resize()
+    size_t cols = static_cast<size_t>(deg) + 1;
+    std::streamoff headerEnd = file.tellg();
+    file.seekg(0, std::ios::end);
+    std::streamoff remaining = file.tellg() - headerEnd;
+    file.seekg(headerEnd);
+    if (!file || remaining < 0 ||
+        count > static_cast<uint64_t>(remaining) / (sizeof(Segment) + 3 * cols * sizeof(double))) {
+        return false;
+    }
+
+    ephemeris.degree = deg;
+    ephemeris.segments.resize(count);
+    ephemeris.coefficients.resize(count * 3 * cols);
+
+    file.read(reinterpret_cast<char*>(ephemeris.segments.data()), count * sizeof(Segment));
+    file.read(reinterpret_cast<char*>(ephemeris.coefficients.data()),
+              ephemeris.coefficients.size() * sizeof(double));
+    if (!file) return false;
+
+    out = std::move(ephemeris);
+    return true;
+}
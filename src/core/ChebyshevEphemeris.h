@@ -0,0 +1,90 @@
+#ifndef CHEBYSHEV_EPHEMERIS_H
+#define CHEBYSHEV_EPHEMERIS_H
+
+#include "StateVector.h"
+#include <cstddef>
+#include <string>
+#include <vector>
+
+/**
+ * Piecewise Chebyshev ephemeris (SPK/SP3 style).
+ *
+ * The trajectory is split into time segments; inside each one the x, y and
+ * z position are a single Chebyshev series. The fit uses both the sampled
+ * positions and velocities (Hermite least squares), so velocity is the
+ * exact derivative of position and both come from one coefficient set.
+ *
+ * Segments are bisected until every input sample is reproduced within the
+ * requested tolerance, down to degree / 2 + 1 samples per segment. A segment
+ * that short is kept even if it misses the tolerance (sampling too coarse
+ * for the arc, e.g. the perigee of an eccentric orbit); withinTolerance()
+ * then reports false and maxPositionError() holds the achieved error.
+ * OrbitPropagator::propagateEphemeris() resamples until the fit passes.
+ *
+ * Evaluation is a binary search plus one pass over the basis: about 20
+ * FLOPs per coefficient for position and velocity together.
+ */
+class ChebyshevEphemeris {
+public:
+    static constexpr int DEFAULT_DEGREE = 12;
+    static constexpr double DEFAULT_TOLERANCE = 1e-3;   // km
+
+    ChebyshevEphemeris();
+
+    // Fit a dense trajectory. tolerance is the max position error (km)
+    // allowed on the input samples.
+    static ChebyshevEphemeris fit(
+        const std::vector<StateVector>& trajectory,
+        int degree = DEFAULT_DEGREE,
+        double tolerance = DEFAULT_TOLERANCE
+    );
+
+    // Position and velocity at time t (clamped to the covered span)
+    StateVector evaluate(double t) const;
+
+    bool empty() const { return segments.empty(); }
+    double startTime() const { return empty() ? 0.0 : segments.front().start; }
+    double endTime() const { return empty() ? 0.0 : segments.back().end; }
+    int getDegree() const { return degree; }
+    size_t segmentCount() const { return segments.size(); }
+
+    // Largest position / velocity error measured on the fitted samples
+    double maxPositionError() const { return positionError; }  // km
+    double maxVelocityError() const { return velocityError; }  // km/s
+
+    // Requested tolerance, and whether every segment met it
+    double getTolerance() const { return tolerance; }
+    bool withinTolerance() const { return positionError <= tolerance; }
+
+    // Heap bytes held by this ephemeris
+    size_t memoryBytes() const;
+
+    // Binary file I/O (little-endian doubles); false on any I/O error
+    bool save(const std::string& path) const;
+    static bool load(const std::string& path, ChebyshevEphemeris& out);
+
+private:
+    struct Segment {
+        double start;
+        double end;
+    };
+
+    int degree;
+    std::vector<Segment> segments;
+    std::vector<double> coefficients;   // 3 * (degree + 1) per segment, x then y then z
+
+    double tolerance;
+    double positionError;
+    double velocityError;
+
+    // Fit samples [first, last] into one segment; returns false if the
+    // tolerance is not met and the range can still be split
+    bool fitSegment(
+        const std::vector<StateVector>& trajectory,
+        size_t first, size_t last, double tolerance
+    );
+
+    size_t findSegment(double t) const;
+};
+
+#endif // CHEBYSHEV_EPHEMERIS_H
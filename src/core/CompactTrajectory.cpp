@@ -0,0 +1,438 @@
+#include "CompactTrajectory.h"
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <type_traits>
+
+namespace {
+    const double INT16_LIMIT = 32767.0;
+
+    // Largest absolute component of a vector
+    double maxComponent(const Vector3D& v) {
+        return std::max(std::fabs(v.x), std::max(std::fabs(v.y), std::fabs(v.z)));
+    }
+
+    // Fixed part of the serialized image; arrays follow in the order
+    // times, block headers, then the six payload components
+    struct ImageHeader {
+        uint32_t encoding;
+        uint32_t blockSize;
+        uint64_t count;
+        uint64_t timeCount;        // 0 when time is implicit
+        uint64_t blockCount;
+        double mu;
+        double startTime;
+        double timestep;
+        double positionErrorBound;
+        double velocityErrorBound;
+    };
+
+    size_t align8(size_t offset) {
+        return (offset + 7) & ~static_cast<size_t>(7);
+    }
+
+    template <typename T>
+    void appendArray(std::string& out, const T* values, size_t count) {
+        out.append(reinterpret_cast<const char*>(values), count * sizeof(T));
+    }
+
+    // View count values at cursor and step past them
+    template <typename T>
+    const T* viewArray(const unsigned char*& cursor, size_t count) {
+        const T* values = reinterpret_cast<const T*>(cursor);
+        cursor += count * sizeof(T);
+        return values;
+    }
+
+    // Apply a quantized residual (shared by encoder and decoder so both
+    // reconstruct bit-identical values)
+    void applyResidual(Vector3D& value, int16_t qx, int16_t qy, int16_t qz, double scale) {
+        value.x += qx * scale;
+        value.y += qy * scale;
+        value.z += qz * scale;
+    }
+}
+
+CompactTrajectory::CompactTrajectory()
+    : encoding(TrajectoryEncoding::Delta16), count(0), mu(MU_EARTH),
+      startTime(0.0), timestep(0.0), times(nullptr), blocks(nullptr),
+      f32{}, i16{}, positionErrorBound(0.0), velocityErrorBound(0.0) {}
+
+CompactTrajectory CompactTrajectory::encode(
+    const std::vector<StateVector>& trajectory,
+    TrajectoryEncoding encoding,
+    double mu
+) {
+    CompactTrajectory compact;
+    compact.encoding = encoding;
+    compact.count = trajectory.size();
+    compact.mu = mu;
+
+    if (trajectory.empty()) return compact;
+
+    std::shared_ptr<Payload> payload = std::make_shared<Payload>();
+
+    // Time base: implicit if uniformly sampled
+    size_t n = trajectory.size();
+    compact.startTime = trajectory[0].time;
+    compact.timestep = (n > 1) ? (trajectory[n - 1].time - compact.startTime) / (n - 1) : 0.0;
+    for (size_t i = 0; i < n; i++) {
+        double expected = compact.startTime + i * compact.timestep;
+        if (std::fabs(trajectory[i].time - expected) > 1e-6) {
+            payload->times.reserve(n);
+            for (const auto& state : trajectory) {
+                payload->times.push_back(state.time);
+            }
+            compact.times = payload->times.data();   // timeAt() while encoding
+            break;
+        }
+    }
+
+    size_t blockCount = (n + BLOCK_SIZE - 1) / BLOCK_SIZE;
+    payload->blocks.reserve(blockCount);
+
+    size_t samples = n - blockCount;
+    for (int c = 0; c < 6; c++) {
+        if (encoding == TrajectoryEncoding::Float32) {
+            payload->f32[c].reserve(samples);
+        } else {
+            payload->i16[c].reserve(samples);
+        }
+    }
+
+    for (size_t b = 0; b < blockCount; b++) {
+        size_t first = b * BLOCK_SIZE;
+        size_t last = std::min(n, first + BLOCK_SIZE) - 1;
+
+        BlockHeader header;
+        header.position = trajectory[first].position;
+        header.velocity = trajectory[first].velocity;
+        header.positionScale = 0.0f;
+        header.velocityScale = 0.0f;
+
+        if (encoding == TrajectoryEncoding::Float32) {
+            double maxPosOffset = 0.0;
+            double maxVelOffset = 0.0;
+
+            for (size_t i = first + 1; i <= last; i++) {
+                Vector3D dp = trajectory[i].position - header.position;
+                Vector3D dv = trajectory[i].velocity - header.velocity;
+
+                payload->f32[0].push_back(static_cast<float>(dp.x));
+                payload->f32[1].push_back(static_cast<float>(dp.y));
+                payload->f32[2].push_back(static_cast<float>(dp.z));
+                payload->f32[3].push_back(static_cast<float>(dv.x));
+                payload->f32[4].push_back(static_cast<float>(dv.y));
+                payload->f32[5].push_back(static_cast<float>(dv.z));
+
+                maxPosOffset = std::max(maxPosOffset, maxComponent(dp));
+                maxVelOffset = std::max(maxVelOffset, maxComponent(dv));
+            }
+
+            // Round-to-nearest float: relative error <= 2^-24 per component
+            const double floatRounding = std::ldexp(1.0, -24) * std::sqrt(3.0);
+            compact.positionErrorBound = std::max(compact.positionErrorBound,
+                                                  maxPosOffset * floatRounding);
+            compact.velocityErrorBound = std::max(compact.velocityErrorBound,
+                                                  maxVelOffset * floatRounding);
+        } else {
+            // Residuals that are non-finite or too large for int16 at any
+            // step size: keep the whole trajectory as Float32 instead
+            if (!encodeDeltaBlock(trajectory, compact, *payload, first, last, header)) {
+                return encode(trajectory, TrajectoryEncoding::Float32, mu);
+            }
+
+            // Closed-loop quantization: each component is off by <= scale/2
+            const double halfDiagonal = 0.5 * std::sqrt(3.0);
+            compact.positionErrorBound = std::max(compact.positionErrorBound,
+                                                  header.positionScale * halfDiagonal);
+            compact.velocityErrorBound = std::max(compact.velocityErrorBound,
+                                                  header.velocityScale * halfDiagonal);
+        }
+
+        payload->blocks.push_back(header);
+    }
+
+    compact.attach(std::move(payload));
+    return compact;
+}
+
+void CompactTrajectory::attach(std::shared_ptr<Payload> payload) {
+    times = payload->times.empty() ? nullptr : payload->times.data();
+    blocks = payload->blocks.data();
+    for (int c = 0; c < 6; c++) {
+        f32[c] = payload->f32[c].data();
+        i16[c] = payload->i16[c].data();
+    }
+    storage = std::move(payload);
+}
+
+bool CompactTrajectory::encodeDeltaBlock(
+    const std::vector<StateVector>& trajectory,
+    const CompactTrajectory& compact,
+    Payload& payload,
+    size_t first, size_t last,
+    BlockHeader& header
+) {
+    // Open-loop pass to size the quantization step
+    double maxPosResidual = 0.0;
+    double maxVelResidual = 0.0;
+    for (size_t i = first + 1; i <= last; i++) {
+        Vector3D p = trajectory[i - 1].position;
+        Vector3D v = trajectory[i - 1].velocity;
+        predict(p, v, compact.timeAt(i) - compact.timeAt(i - 1), compact.mu);
+
+        maxPosResidual = std::max(maxPosResidual, maxComponent(trajectory[i].position - p));
+        maxVelResidual = std::max(maxVelResidual, maxComponent(trajectory[i].velocity - v));
+    }
+
+    // 25% headroom: closed-loop residuals differ slightly from open-loop ones
+    float posScale = static_cast<float>(std::max(maxPosResidual * 1.25 / INT16_LIMIT, 1e-12));
+    float velScale = static_cast<float>(std::max(maxVelResidual * 1.25 / INT16_LIMIT, 1e-15));
+
+    size_t length = last - first;
+    int16_t quantized[6][BLOCK_SIZE];
+
+    // Closed-loop pass; widen the step if anything overflows int16
+    bool fits = false;
+    for (int attempt = 0; attempt < 32 && !fits; attempt++) {
+        Vector3D p = header.position;
+        Vector3D v = header.velocity;
+        fits = true;
+
+        for (size_t k = 0; k < length && fits; k++) {
+            size_t i = first + 1 + k;
+            predict(p, v, compact.timeAt(i) - compact.timeAt(i - 1), compact.mu);
+
+            Vector3D rp = trajectory[i].position - p;
+            Vector3D rv = trajectory[i].velocity - v;
+            double residuals[6] = {
+                rp.x / posScale, rp.y / posScale, rp.z / posScale,
+                rv.x / velScale, rv.y / velScale, rv.z / velScale
+            };
+
+            for (int c = 0; c < 6; c++) {
+                double q = std::nearbyint(residuals[c]);
+                if (!std::isfinite(q)) return false;
+                if (std::fabs(q) > INT16_LIMIT) {
+                    fits = false;
+                    break;
+                }
+                quantized[c][k] = static_cast<int16_t>(q);
+            }
+
+            if (fits) {
+                applyResidual(p, quantized[0][k], quantized[1][k], quantized[2][k], posScale);
+                applyResidual(v, quantized[3][k], quantized[4][k], quantized[5][k], velScale);
+            }
+        }
+
+        if (!fits) {
+            posScale *= 2.0f;
+            velScale *= 2.0f;
+        }
+    }
+    if (!fits) return false;
+
+    header.positionScale = posScale;
+    header.velocityScale = velScale;
+
+    for (int c = 0; c < 6; c++) {
+        payload.i16[c].insert(payload.i16[c].end(), quantized[c], quantized[c] + length);
+    }
+    return true;
+}
+
+void CompactTrajectory::predict(Vector3D& position, Vector3D& velocity, double dt, double mu) {
+    // Velocity-Verlet step under point-mass gravity
+    double r0 = position.magnitude();
+    Vector3D a0 = position * (-mu / (r0 * r0 * r0));
+
+    position = position + velocity * dt + a0 * (0.5 * dt * dt);
+
+    double r1 = position.magnitude();
+    Vector3D a1 = position * (-mu / (r1 * r1 * r1));
+
+    velocity = velocity + (a0 + a1) * (0.5 * dt);
+}
+
+double CompactTrajectory::timeAt(size_t index) const {
+    if (times) return times[index];
+    return startTime + index * timestep;
+}
+
+StateVector CompactTrajectory::state(size_t index) const {
+    size_t b = index / BLOCK_SIZE;
+    size_t k = index % BLOCK_SIZE;
+    const BlockHeader& header = blocks[b];
+    size_t base = b * (BLOCK_SIZE - 1);
+
+    if (k == 0) {
+        return StateVector(header.position, header.velocity, timeAt(index));
+    }
+
+    if (encoding == TrajectoryEncoding::Float32) {
+        size_t j = base + k - 1;
+        Vector3D p = header.position + Vector3D(f32[0][j], f32[1][j], f32[2][j]);
+        Vector3D v = header.velocity + Vector3D(f32[3][j], f32[4][j], f32[5][j]);
+        return StateVector(p, v, timeAt(index));
+    }
+
+    // Delta16: replay the predictor from the block anchor
+    Vector3D p = header.position;
+    Vector3D v = header.velocity;
+    size_t first = b * BLOCK_SIZE;
+    for (size_t m = 1; m <= k; m++) {
+        size_t j = base + m - 1;
+        predict(p, v, timeAt(first + m) - timeAt(first + m - 1), mu);
+        applyResidual(p, i16[0][j], i16[1][j], i16[2][j], header.positionScale);
+        applyResidual(v, i16[3][j], i16[4][j], i16[5][j], header.velocityScale);
+    }
+    return StateVector(p, v, timeAt(index));
+}
+
+void CompactTrajectory::decodeRange(size_t first, size_t length, std::vector<StateVector>& out) const {
+    size_t end = std::min(count, first + length);
+    if (first >= end) return;
+
+    out.reserve(out.size() + (end - first));
+
+    if (encoding == TrajectoryEncoding::Float32) {
+        for (size_t i = first; i < end; i++) {
+            out.push_back(state(i));
+        }
+        return;
+    }
+
+    // Delta16: decode each touched block once, sequentially
+    size_t i = first;
+    while (i < end) {
+        size_t b = i / BLOCK_SIZE;
+        size_t blockStart = b * BLOCK_SIZE;
+        size_t blockEnd = std::min(count, blockStart + BLOCK_SIZE);
+        size_t base = b * (BLOCK_SIZE - 1);
+        const BlockHeader& header = blocks[b];
+
+        Vector3D p = header.position;
+        Vector3D v = header.velocity;
+        for (size_t m = blockStart; m < blockEnd && m < end; m++) {
+            if (m > blockStart) {
+                size_t j = base + (m - blockStart) - 1;
+                predict(p, v, timeAt(m) - timeAt(m - 1), mu);
+                applyResidual(p, i16[0][j], i16[1][j], i16[2][j], header.positionScale);
+                applyResidual(v, i16[3][j], i16[4][j], i16[5][j], header.velocityScale);
+            }
+            if (m >= i) {
+                out.push_back(StateVector(p, v, timeAt(m)));
+            }
+        }
+        i = std::min(end, blockEnd);
+    }
+}
+
+std::vector<StateVector> CompactTrajectory::decode() const {
+    std::vector<StateVector> out;
+    decodeRange(0, count, out);
+    return out;
+}
+
+size_t CompactTrajectory::memoryBytes() const {
+    size_t blockCount = (count + BLOCK_SIZE - 1) / BLOCK_SIZE;
+    size_t componentSize = (encoding == TrajectoryEncoding::Float32) ? sizeof(float) : sizeof(int16_t);
+    size_t bytes = blockCount * sizeof(BlockHeader) + 6 * (count - blockCount) * componentSize;
+    if (times) bytes += count * sizeof(double);
+    return bytes;
+}
+
+void CompactTrajectory::serialize(std::string& out) const {
+    static_assert(std::is_trivially_copyable<BlockHeader>::value,
+                  "Block headers are written byte for byte");
+
+    ImageHeader header;
+    header.encoding = static_cast<uint32_t>(encoding);
+    header.blockSize = BLOCK_SIZE;
+    header.count = count;
+    size_t blockCount = (count + BLOCK_SIZE - 1) / BLOCK_SIZE;
+    size_t samples = count - blockCount;
+    header.timeCount = times ? count : 0;
+    header.blockCount = blockCount;
+    header.mu = mu;
+    header.startTime = startTime;
+    header.timestep = timestep;
+    header.positionErrorBound = positionErrorBound;
+    header.velocityErrorBound = velocityErrorBound;
+
+    size_t start = out.size();
+    out.append(reinterpret_cast<const char*>(&header), sizeof(header));
+    appendArray(out, times, static_cast<size_t>(header.timeCount));
+    appendArray(out, blocks, blockCount);
+    for (int c = 0; c < 6; c++) {
+        if (encoding == TrajectoryEncoding::Float32) {
+            appendArray(out, f32[c], samples);
+        } else {
+            appendArray(out, i16[c], samples);
+        }
+    }
+    out.append(align8(out.size() - start) - (out.size() - start), '\0');
+}
+
+bool CompactTrajectory::view(const unsigned char* data, size_t size,
+                             std::shared_ptr<const void> owner, CompactTrajectory& out) {
+    // Arrays are read in place: with an 8-aligned image every section
+    // starts aligned, as each one spans a multiple of the next one's alignment
+    static_assert(sizeof(ImageHeader) % alignof(double) == 0 &&
+                  sizeof(BlockHeader) % alignof(double) == 0,
+                  "Image sections must stay 8-byte aligned");
+    if (size < sizeof(ImageHeader) || reinterpret_cast<uintptr_t>(data) % alignof(double) != 0) {
+        return false;
+    }
+    ImageHeader header;
+    std::memcpy(&header, data, sizeof(header));
+
+    if (header.encoding > static_cast<uint32_t>(TrajectoryEncoding::Delta16) ||
+        header.blockSize != BLOCK_SIZE) {
+        return false;
+    }
+
+    // Every state costs at least two payload bytes, so these bounds keep the
+    // size arithmetic below from overflowing on a corrupt header
+    if (header.count > size ||
+        header.blockCount != (header.count + BLOCK_SIZE - 1) / BLOCK_SIZE ||
+        (header.timeCount != 0 && header.timeCount != header.count)) {
+        return false;
+    }
+
+    TrajectoryEncoding encoding = static_cast<TrajectoryEncoding>(header.encoding);
+    size_t componentSize = (encoding == TrajectoryEncoding::Float32) ? sizeof(float) : sizeof(int16_t);
+    size_t payload = static_cast<size_t>(header.count - header.blockCount);
+    size_t expected = sizeof(ImageHeader) +
+                      static_cast<size_t>(header.timeCount) * sizeof(double) +
+                      static_cast<size_t>(header.blockCount) * sizeof(BlockHeader) +
+                      6 * payload * componentSize;
+    if (align8(expected) != size) return false;
+
+    CompactTrajectory compact;
+    compact.encoding = encoding;
+    compact.count = static_cast<size_t>(header.count);
+    compact.mu = header.mu;
+    compact.startTime = header.startTime;
+    compact.timestep = header.timestep;
+    compact.positionErrorBound = header.positionErrorBound;
+    compact.velocityErrorBound = header.velocityErrorBound;
+
+    const unsigned char* cursor = data + sizeof(ImageHeader);
+    compact.times = viewArray<double>(cursor, static_cast<size_t>(header.timeCount));
+    if (header.timeCount == 0) compact.times = nullptr;
+    compact.blocks = viewArray<BlockHeader>(cursor, static_cast<size_t>(header.blockCount));
+    for (int c = 0; c < 6; c++) {
+        if (encoding == TrajectoryEncoding::Float32) {
+            compact.f32[c] = viewArray<float>(cursor, payload);
+        } else {
+            compact.i16[c] = viewArray<int16_t>(cursor, payload);
+        }
+    }
+    compact.storage = std::move(owner);
+
+    out = std::move(compact);
+    return true;
+}
@@ -0,0 +1,150 @@
+#ifndef COMPACT_TRAJECTORY_H
+#define COMPACT_TRAJECTORY_H
+
+#include "StateVector.h"
+#include "Constants.h"
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+// Storage formats for CompactTrajectory
+enum class TrajectoryEncoding {
+    // float32 offsets from a per-block double reference, ~25 bytes/state
+    // with block anchors (2.2x smaller than StateVector). Error ~1e-7 of the
+    // block span: up to a metre in position for high orbits, micrometres/s
+    // in velocity.
+    Float32,
+
+    // int16 residuals against a two-body predictor, ~13.5 bytes/state
+    // (4.2x smaller). Error is bounded per block by half a quantization step:
+    // under a millimetre in LEO, up to ~0.1 m for Molniya and GTO at 360
+    // samples per orbit; see maxPositionError(). mdv_accuracy measures both.
+    Delta16
+};
+
+/**
+ * Memory-compact trajectory container (SoA layout).
+ *
+ * Samples are grouped in blocks of BLOCK_SIZE. Each block keeps its first
+ * state in full double precision; the remaining states are stored as
+ * narrow per-component arrays. Any state can be decoded in O(BLOCK_SIZE)
+ * without touching other blocks.
+ *
+ * Time is stored implicitly (t0 + i * dt) when the input is uniformly
+ * sampled, as everything OrbitPropagator::propagate produces is. Irregular
+ * input keeps an explicit time array.
+ *
+ * Error bounds are exact, not estimates: maxPositionError() and
+ * maxVelocityError() return the largest deviation any decoded sample can
+ * have from the original. For rendering (1 unit = 1000 km, float vertices)
+ * both encodings are far below one float ulp.
+ *
+ * The payload is immutable and shared: copies are cheap and safe to read
+ * from several threads. It either belongs to the container (encode()) or
+ * is a serialized image used in place, e.g. a mapped cache file (view()).
+ */
+class CompactTrajectory {
+public:
+    static constexpr size_t BLOCK_SIZE = 32;
+
+    CompactTrajectory();
+
+    // Encode a dense trajectory (mu is used by the Delta16 predictor).
+    // Delta16 falls back to Float32 when a block's residuals are non-finite
+    // or do not fit int16 at any step size; check getEncoding().
+    static CompactTrajectory encode(
+        const std::vector<StateVector>& trajectory,
+        TrajectoryEncoding encoding = TrajectoryEncoding::Delta16,
+        double mu = MU_EARTH
+    );
+
+    // Random access decode of one state
+    StateVector state(size_t index) const;
+
+    // Decode states [first, first + count) into out (appends)
+    void decodeRange(size_t first, size_t count, std::vector<StateVector>& out) const;
+
+    // Decode everything
+    std::vector<StateVector> decode() const;
+
+    size_t size() const { return count; }
+    bool empty() const { return count == 0; }
+    TrajectoryEncoding getEncoding() const { return encoding; }
+
+    // Guaranteed worst-case decode error
+    double maxPositionError() const { return positionErrorBound; }  // km
+    double maxVelocityError() const { return velocityErrorBound; }  // km/s
+
+    // Payload bytes read by this container, on the heap or in a mapped file
+    size_t memoryBytes() const;
+
+    // Flat byte image for files, appended to out and padded to 8 bytes
+    void serialize(std::string& out) const;
+
+    // Use a serialized image in place, without copying it. `owner` keeps
+    // data alive for as long as any copy of out. Fails unless the image is
+    // 8-byte aligned, its counts are consistent and it is exactly size
+    // bytes long.
+    static bool view(const unsigned char* data, size_t size,
+                     std::shared_ptr<const void> owner, CompactTrajectory& out);
+
+private:
+    // Full-precision anchor for one block
+    struct BlockHeader {
+        Vector3D position;
+        Vector3D velocity;
+        float positionScale;   // Delta16 quantization step (km)
+        float velocityScale;   // Delta16 quantization step (km/s)
+    };
+
+    TrajectoryEncoding encoding;
+    size_t count;
+    double mu;
+
+    // Arrays filled by encode()
+    struct Payload {
+        std::vector<double> times;
+        std::vector<BlockHeader> blocks;
+        std::vector<float> f32[6];
+        std::vector<int16_t> i16[6];
+    };
+
+    // Implicit time base (explicit times only for irregular sampling)
+    double startTime;
+    double timestep;
+
+    // Keeps the arrays below alive: a Payload or a serialized image's owner
+    std::shared_ptr<const void> storage;
+    const double* times;                // nullptr when time is implicit
+    const BlockHeader* blocks;
+
+    // Per-component SoA payload, one of the two sets is used
+    const float* f32[6];
+    const int16_t* i16[6];
+
+    double positionErrorBound;
+    double velocityErrorBound;
+
+    double timeAt(size_t index) const;
+
+    // Two-body prediction of the next sample from the previous one
+    static void predict(Vector3D& position, Vector3D& velocity, double dt, double mu);
+
+    // Quantize samples (first, last] of one block into payload.i16,
+    // filling the scales. False (nothing appended) if the residuals cannot
+    // be quantized.
+    static bool encodeDeltaBlock(
+        const std::vector<StateVector>& trajectory,
+        const CompactTrajectory& compact,
+        Payload& payload,
+        size_t first, size_t last,
+        BlockHeader& header
+    );
+
+    // Point the views at a finished Payload and take ownership of it
+    void attach(std::shared_ptr<Payload> payload);
+};
+
+#endif // COMPACT_TRAJECTORY_H
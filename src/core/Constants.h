@@ -18,6 +18,7 @@ const double EARTH_J4 = -1.61962e-6;       // J4 coefficient - for future
 
 // Rendering Constants
 const float SCALE = 0.001f;  // 1 unit = 1000 km
+const float ORBIT_LOD_PIXEL_ERROR = 1.0f;  // Max on-screen deviation of decimated orbit lines
 
 // Sun Constants
 const double SUN_ANGULAR_RADIUS = 0.267 * M_PI / 180.0; // radians
@@ -45,7 +46,22 @@ const float CAMERA_MAX_DISTANCE = 200.0f;
 const float MAX_ANIMATION_SPEED = 10.0f;
 const float MIN_ANIMATION_SPEED = 0.05f;
 
+// UI Refresh
+const double UI_VALUE_REFRESH_INTERVAL = 0.1;  // s, cap on redrawing cached panels whose numbers change
+
 // Satellite Trail
 const size_t TRAIL_LENGTH = 25;
 
+// Trajectory sampling (points per orbital period)
+const int ORBIT_SAMPLES_PER_PERIOD = 360;
+
+// Trajectory cache location (relative to the working directory)
+const char* const TRAJECTORY_CACHE_DIR = "mdv_cache";
+
+// Profiler trace export (open in chrome://tracing or Perfetto)
+const char* const PROFILE_TRACE_PATH = "mdv_trace.json";
+
+// Simulation Thread
+const double SIMULATION_TICK_RATE = 60.0;  // Hz
+
 #endif // CONSTANTS_H
\ No newline at end of file
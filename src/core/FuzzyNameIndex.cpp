@@ -0,0 +1,102 @@
+#include "FuzzyNameIndex.h"
+#include <algorithm>
+#include <cctype>
+#include <utility>
+
+void FuzzyNameIndex::build(const std::vector<std::string>& source) {
+    names.resize(source.size());
+    masks.resize(source.size());
+    matches.resize(source.size());
+    for (size_t i = 0; i < source.size(); i++) {
+        names[i] = lowercase(source[i]);
+        masks[i] = characterMask(names[i]);
+        matches[i] = static_cast<uint32_t>(i);
+    }
+    lastQuery.clear();
+}
+
+const std::vector<uint32_t>& FuzzyNameIndex::search(const std::string& query) {
+    std::string q = lowercase(query);
+    if (q == lastQuery) return matches;
+
+    if (q.empty()) {
+        matches.resize(names.size());
+        for (size_t i = 0; i < names.size(); i++) matches[i] = static_cast<uint32_t>(i);
+        lastQuery.clear();
+        return matches;
+    }
+
+    // Narrow the previous result when the query only grew
+    bool narrowing = !lastQuery.empty() && q.size() > lastQuery.size() &&
+                     q.compare(0, lastQuery.size(), lastQuery) == 0;
+    size_t candidateCount = narrowing ? matches.size() : names.size();
+    uint64_t queryMask = characterMask(q);
+
+    std::vector<std::pair<int, uint32_t>> scored;
+    for (size_t c = 0; c < candidateCount; c++) {
+        uint32_t i = narrowing ? matches[c] : static_cast<uint32_t>(c);
+        if ((masks[i] & queryMask) != queryMask) continue;
+
+        int s = score(names[i], q);
+        if (s >= 0) scored.push_back({s, i});
+    }
+
+    std::sort(scored.begin(), scored.end(), [](const std::pair<int, uint32_t>& a,
+                                               const std::pair<int, uint32_t>& b) {
+        return a.first != b.first ? a.first > b.first : a.second < b.second;
+    });
+
+    matches.resize(scored.size());
+    for (size_t i = 0; i < scored.size(); i++) matches[i] = scored[i].second;
+    lastQuery = q;
+    return matches;
+}
+
+int FuzzyNameIndex::score(const std::string& name, const std::string& query) {
+    if (query.empty()) return 0;
+
+    // Greedy left-to-right match
+    int total = 0;
+    size_t q = 0;
+    size_t first = 0;
+    size_t previous = 0;
+    for (size_t i = 0; i < name.size() && q < query.size(); i++) {
+        if (name[i] != query[q]) continue;
+
+        int bonus = 1;
+        if (i == 0 || !std::isalnum(static_cast<unsigned char>(name[i - 1]))) bonus += 8;  // Word start
+        if (q > 0 && previous + 1 == i) bonus += 4;                                           // Consecutive
+        if (q == 0) first = i;
+
+        total += bonus;
+        previous = i;
+        q++;
+    }
+    if (q < query.size()) return -1;
+
+    // Penalise characters skipped inside the match
+    int gaps = static_cast<int>(previous - first + 1 - query.size());
+    return std::max(0, total * 4 - gaps);
+}
+
+std::string FuzzyNameIndex::lowercase(const std::string& text) {
+    std::string result(text);
+    for (char& c : result) {
+        c = static_cast<char>(std::tolower(static_cast<unsigned char>(c)));
+    }
+    return result;
+}
+
+uint64_t FuzzyNameIndex::characterMask(const std::string& text) {
+    uint64_t mask = 0;
+    for (unsigned char c : text) {
+        if (c >= 'a' && c <= 'z') {
+            mask |= 1ull << (c - 'a');
+        } else if (c >= '0' && c <= '9') {
+            mask |= 1ull << (26 + c - '0');
+        } else {
+            mask |= 1ull << (36 + c % 28);
+        }
+    }
+    return mask;
+}
@@ -0,0 +1,41 @@
+#ifndef FUZZY_NAME_INDEX_H
+#define FUZZY_NAME_INDEX_H
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/**
+ * Incremental fuzzy search over a fixed list of names.
+ *
+ * A name matches when it contains the query's characters in order, ignoring
+ * case. Names are lowercased once at build time together with a bitmask of
+ * the characters they contain, so most candidates are rejected with a single
+ * AND. Typing extends the previous query, and any name matching the longer
+ * query also matched the shorter one, so only the previous matches are
+ * rescanned.
+ */
+class FuzzyNameIndex {
+public:
+    void build(const std::vector<std::string>& names);
+    size_t size() const { return names.size(); }
+
+    // Indices of matching names, best first (ties in index order); the
+    // empty query matches everything in index order
+    const std::vector<uint32_t>& search(const std::string& query);
+
+    // Score of a lowercase name against a lowercase query, -1 if no match.
+    // Matches at word starts and runs of consecutive characters score higher.
+    static int score(const std::string& name, const std::string& query);
+
+private:
+    std::vector<std::string> names;     // Lowercase
+    std::vector<uint64_t> masks;        // Characters present in each name
+    std::string lastQuery;              // Lowercase
+    std::vector<uint32_t> matches;      // Result of lastQuery
+
+    static std::string lowercase(const std::string& text);
+    static uint64_t characterMask(const std::string& text);
+};
+
+#endif // FUZZY_NAME_INDEX_H
@@ -0,0 +1,252 @@
+#include "KeplerSolver.h"
+#include "Constants.h"
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+
+namespace {
+    const double TWO_PI = 2.0 * M_PI;
+
+    // The kernels below replace the libm calls in the solver loops. libm
+    // sin/cos/sinh/log are opaque calls the compiler cannot vectorize; these
+    // are straight-line arithmetic with no comparisons (quadrant and range
+    // choices are made with 0/1 factors and integer bit operations), so each
+    // solver stage compiles to SIMD code at the baseline ISA: SSE2 on x86-64,
+    // NEON on AArch64, wider with -march. Coefficients are fdlibm's.
+
+    // Round to nearest (|x| < 2^51) without roundsd, which needs SSE4.1
+    inline double roundNearest(double x) {
+        const double shifter = 6755399441055744.0;   // 1.5 * 2^52
+        return (x + shifter) - shifter;
+    }
+
+    inline uint64_t bitsOf(double x) {
+        uint64_t bits;
+        std::memcpy(&bits, &x, sizeof(bits));
+        return bits;
+    }
+
+    inline double fromBits(uint64_t bits) {
+        double x;
+        std::memcpy(&x, &bits, sizeof(x));
+        return x;
+    }
+
+    // 2^k for integral k in [-1022, 1023], assembled in the exponent bits
+    // (k + 1023 lands in the low mantissa bits of 2^52 + k + 1023)
+    inline double powerOfTwo(double k) {
+        return fromBits(bitsOf(k + (4503599627370496.0 + 1023.0)) << 52);
+    }
+
+    // sin and cos together for |x| < 1e6 (within ~1 ulp): reduce by pi/2 in
+    // two parts (Cody-Waite), evaluate both polynomials on [-pi/4, pi/4],
+    // then swap and negate them by quadrant
+    inline void sinCos(double x, double& sinX, double& cosX) {
+        const double INV_PIO2 = 6.36619772367581382433e-01;
+        const double PIO2_HI = 1.57079632673412561417e+00;   // 33 bits: q * PIO2_HI is exact
+        const double PIO2_LO = 6.07710050650619224932e-11;
+
+        double q = roundNearest(x * INV_PIO2);
+        double r = (x - q * PIO2_HI) - q * PIO2_LO;
+        double z = r * r;
+
+        double s = r + r * z * (-1.66666666666666324348e-01 + z * (8.33333333332248946124e-03 +
+                   z * (-1.98412698298579493134e-04 + z * (2.75573137070700676789e-06 +
+                   z * (-2.50507602534068634195e-08 + z * 1.58969099521155010221e-10)))));
+        double c = 1.0 - 0.5 * z + z * z * (4.16666666666666019037e-02 + z * (-1.38888888888741095749e-03 +
+                   z * (2.48015872894767294178e-05 + z * (-2.75573143513906633035e-07 +
+                   z * (2.08757232129817482790e-09 + z * -1.13596475577881948265e-11)))));
+
+        // The two low bits of q as exact 0/1 doubles (floor(q / 2) = round(q / 2 - 1/4)
+        // for integer q): odd quadrants swap sin and cos, quadrants 2 and 3 negate
+        // sin, quadrants 1 and 2 negate cos
+        double half = roundNearest(0.5 * q - 0.25);
+        double odd = q - 2.0 * half;
+        double high = half - 2.0 * roundNearest(0.5 * half - 0.25);
+        double sinR = odd * c + (1.0 - odd) * s;
+        double cosR = odd * s + (1.0 - odd) * c;
+        sinX = (1.0 - 2.0 * high) * sinR;
+        cosX = (1.0 - 2.0 * (odd + high - 2.0 * odd * high)) * cosR;
+    }
+
+    // e^x and e^x - 1 together for |x| < 708: x = k ln2 + r with |r| <= ln2 / 2,
+    // p = e^r - 1 from the fdlibm rational form, then e^x = 2^k (1 + p) and
+    // e^x - 1 = 2^k p + (2^k - 1), neither of which cancels
+    inline void expKernel(double x, double& expX, double& expm1X) {
+        const double INV_LN2 = 1.44269504088896338700e+00;
+        const double LN2_HI = 6.93147180369123816490e-01;
+        const double LN2_LO = 1.90821492927058770002e-10;
+
+        double k = roundNearest(x * INV_LN2);
+        double r = (x - k * LN2_HI) - k * LN2_LO;
+        double t = r * r;
+        double c = r - t * (1.66666666666666019037e-01 + t * (-2.77777777770155933842e-03 +
+                   t * (6.61375632143793436117e-05 + t * (-1.65339022054652515390e-06 +
+                   t * 4.13813679705723846039e-08))));
+        double p = r - r * c / (c - 2.0);
+        double scale = powerOfTwo(k);
+        expX = scale + scale * p;
+        expm1X = scale * p + (scale - 1.0);
+    }
+
+    // Natural log for x >= sqrt(1/2): x = 2^k m with m in [sqrt(1/2), sqrt(2)),
+    // split off in the integer bits (offsetting by the bits of sqrt(1/2) makes
+    // the exponent field k directly), then log m = 2 atanh(s), s = (m - 1) / (m + 1)
+    inline double logKernel(double x) {
+        const double LN2 = 6.93147180559945286227e-01;
+        const uint64_t SQRT_HALF_BITS = 0x3FE6A09E667F3BCDull;
+        const uint64_t EXPONENT = 0xFFF0000000000000ull;
+
+        uint64_t offset = bitsOf(x) - SQRT_HALF_BITS;
+        double m = fromBits(bitsOf(x) - (offset & EXPONENT));
+        double k = fromBits((offset >> 52) | 0x4330000000000000ull) - 4503599627370496.0;
+
+        // |s| < 0.172: the series to s^21 is below one ulp
+        double s = (m - 1.0) / (m + 1.0);
+        double z = s * s;
+        double series = 1.0 + z * (1.0 / 3 + z * (1.0 / 5 + z * (1.0 / 7 + z * (1.0 / 9 + z * (1.0 / 11 +
+                         z * (1.0 / 13 + z * (1.0 / 15 + z * (1.0 / 17 + z * (1.0 / 19 + z * (1.0 / 21))))))))));
+        return k * LN2 + 2.0 * s * series;
+    }
+
+    // sinh and cosh together: sinh x = u (u + 2) / (2 e^x) with u = e^x - 1
+    // keeps full relative accuracy near zero, where (e^x - e^-x) / 2 cancels
+    inline void sinhCosh(double x, double& sinhX, double& coshX) {
+        double ex, u;
+        expKernel(x, ex, u);
+        sinhX = 0.5 * u * ((u + 2.0) / ex);
+        coshX = 0.5 * (ex + 1.0 / ex);
+    }
+
+    // Solver stages shared by the scalar and batch forms. The batch forms
+    // run each stage as its own flat loop over a block of lanes (a loop
+    // nest around the fixed Halley count is not vectorized).
+    const size_t BLOCK_WIDTH = 64;
+
+    // Starter for m0 in [0, pi], exact at M = 0
+    inline double ellipticStarter(double m0, double e) {
+        double sinM, cosM, sinShifted, cosShifted;
+        sinCos(m0, sinM, cosM);
+        sinCos(m0 + e, sinShifted, cosShifted);
+        return m0 + e * sinM / (1.0 - sinShifted + sinM);
+    }
+
+    inline double ellipticHalley(double x, double m0, double e) {
+        double sinX, cosX;
+        sinCos(x, sinX, cosX);
+        double s = e * sinX;
+        double c = e * cosX;
+        double f = x - s - m0;
+        double df = 1.0 - c;
+        return x - f * df / (df * df - 0.5 * f * s);
+    }
+
+    inline double hyperbolicStarter(double m, double e) {
+        return std::copysign(logKernel(2.0 * std::fabs(m) / e + 1.8), m);
+    }
+
+    inline double hyperbolicHalley(double x, double m, double e) {
+        double sinhX, coshX;
+        sinhCosh(x, sinhX, coshX);
+        double s = e * sinhX;
+        double c = e * coshX;
+        double f = s - x - m;
+        double df = c - 1.0;
+        return x - f * df / (df * df - 0.5 * f * s);
+    }
+}
+
+double KeplerSolver::solveElliptic(double meanAnomaly, double eccentricity) {
+    // Reduce to [-pi, pi]; the whole revolutions are added back at the end.
+    // Odd in M, so solve on [0, pi].
+    double revolutions = roundNearest(meanAnomaly / TWO_PI);
+    double reduced = meanAnomaly - revolutions * TWO_PI;
+    double m0 = std::fabs(reduced);
+
+    double x = ellipticStarter(m0, eccentricity);
+    for (int i = 0; i < ELLIPTIC_ITERATIONS; i++) {
+        x = ellipticHalley(x, m0, eccentricity);
+    }
+    return std::copysign(x, reduced) + revolutions * TWO_PI;
+}
+
+double KeplerSolver::solveHyperbolic(double meanAnomaly, double eccentricity) {
+    double x = hyperbolicStarter(meanAnomaly, eccentricity);
+    for (int i = 0; i < HYPERBOLIC_ITERATIONS; i++) {
+        x = hyperbolicHalley(x, meanAnomaly, eccentricity);
+    }
+    return x;
+}
+
+void KeplerSolver::solveElliptic(const double* meanAnomaly, const double* eccentricity,
+                                 double* anomaly, size_t count) {
+    double revolutions[BLOCK_WIDTH], reduced[BLOCK_WIDTH], x[BLOCK_WIDTH];
+
+    for (size_t first = 0; first < count; first += BLOCK_WIDTH) {
+        const size_t n = std::min(BLOCK_WIDTH, count - first);
+        const double* m = meanAnomaly + first;
+        const double* e = eccentricity + first;
+
+        for (size_t k = 0; k < n; k++) {
+            revolutions[k] = roundNearest(m[k] / TWO_PI);
+            reduced[k] = m[k] - revolutions[k] * TWO_PI;
+            x[k] = ellipticStarter(std::fabs(reduced[k]), e[k]);
+        }
+        for (int i = 0; i < ELLIPTIC_ITERATIONS; i++) {
+            for (size_t k = 0; k < n; k++) {
+                x[k] = ellipticHalley(x[k], std::fabs(reduced[k]), e[k]);
+            }
+        }
+        for (size_t k = 0; k < n; k++) {
+            anomaly[first + k] = std::copysign(x[k], reduced[k]) + revolutions[k] * TWO_PI;
+        }
+    }
+}
+
+void KeplerSolver::solveHyperbolic(const double* meanAnomaly, const double* eccentricity,
+                                   double* anomaly, size_t count) {
+    double x[BLOCK_WIDTH];
+
+    for (size_t first = 0; first < count; first += BLOCK_WIDTH) {
+        const size_t n = std::min(BLOCK_WIDTH, count - first);
+        const double* m = meanAnomaly + first;
+        const double* e = eccentricity + first;
+
+        for (size_t k = 0; k < n; k++) {
+            x[k] = hyperbolicStarter(m[k], e[k]);
+        }
+        for (int i = 0; i < HYPERBOLIC_ITERATIONS; i++) {
+            for (size_t k = 0; k < n; k++) {
+                x[k] = hyperbolicHalley(x[k], m[k], e[k]);
+            }
+        }
+        for (size_t k = 0; k < n; k++) {
+            anomaly[first + k] = x[k];
+        }
+    }
+}
+
+double KeplerSolver::trueFromEccentric(double eccentricAnomaly, double eccentricity) {
+    double beta = std::sqrt((1.0 + eccentricity) * (1.0 - eccentricity));
+    return std::atan2(beta * std::sin(eccentricAnomaly), std::cos(eccentricAnomaly) - eccentricity);
+}
+
+double KeplerSolver::trueFromHyperbolic(double hyperbolicAnomaly, double eccentricity) {
+    double beta = std::sqrt((eccentricity + 1.0) * (eccentricity - 1.0));
+    return std::atan2(beta * std::sinh(hyperbolicAnomaly), eccentricity - std::cosh(hyperbolicAnomaly));
+}
+
+double KeplerSolver::meanFromTrue(double trueAnomaly, double eccentricity) {
+    double c = std::cos(trueAnomaly);
+    double s = std::sin(trueAnomaly);
+    double denominator = 1.0 + eccentricity * c;
+    if (eccentricity < 1.0) {
+        double beta = std::sqrt((1.0 + eccentricity) * (1.0 - eccentricity));
+        double eccentric = std::atan2(beta * s, eccentricity + c);
+        return eccentric - eccentricity * beta * s / denominator;
+    }
+    double beta = std::sqrt((eccentricity + 1.0) * (eccentricity - 1.0));
+    double hyperbolic = std::asinh(beta * s / denominator);
+    return eccentricity * std::sinh(hyperbolic) - hyperbolic;
+}
@@ -0,0 +1,44 @@
+#ifndef KEPLER_SOLVER_H
+#define KEPLER_SOLVER_H
+
+#include <cstddef>
+
+/**
+ * Kepler's equation, M = E - e sin E (elliptic) or M = e sinh H - H
+ * (hyperbolic), solved for the eccentric/hyperbolic anomaly.
+ *
+ * Every solve takes a fixed number of Halley iterations from a closed-form
+ * starter (M + e sin M / (1 - sin(M + e) + sin M) for ellipses, logarithmic
+ * for hyperbolas), with no convergence test. sin/cos, sinh/cosh and log are
+ * inline polynomial kernels rather than libm calls, so the batch forms run
+ * each stage (starter, each iteration) as a flat loop over a block of lanes
+ * that vectorizes at the baseline ISA (SSE2 pairs on x86-64, wider with
+ * -march). Results are accurate to a few ulp for e up to 0.999 (elliptic)
+ * and e from 1.01 to 50 (hyperbolic).
+ */
+class KeplerSolver {
+public:
+    static constexpr int ELLIPTIC_ITERATIONS = 5;
+    static constexpr int HYPERBOLIC_ITERATIONS = 6;
+
+    // Eccentric anomaly for any mean anomaly (not reduced; E - M is periodic)
+    static double solveElliptic(double meanAnomaly, double eccentricity);
+
+    // Hyperbolic anomaly, e > 1
+    static double solveHyperbolic(double meanAnomaly, double eccentricity);
+
+    // Batch forms: anomaly[k] from meanAnomaly[k] and eccentricity[k]
+    static void solveElliptic(const double* meanAnomaly, const double* eccentricity,
+                              double* anomaly, size_t count);
+    static void solveHyperbolic(const double* meanAnomaly, const double* eccentricity,
+                                double* anomaly, size_t count);
+
+    // True anomaly from the eccentric / hyperbolic anomaly
+    static double trueFromEccentric(double eccentricAnomaly, double eccentricity);
+    static double trueFromHyperbolic(double hyperbolicAnomaly, double eccentricity);
+
+    // Mean anomaly from the true anomaly (inverse of the above)
+    static double meanFromTrue(double trueAnomaly, double eccentricity);
+};
+
+#endif // KEPLER_SOLVER_H
@@ -0,0 +1,41 @@
+#ifndef MAPPED_FILE_H
+#define MAPPED_FILE_H
+
+#include <cstddef>
+#include <string>
+
+/**
+ * Read-only memory-mapped file (mmap on POSIX, file mapping on Windows).
+ *
+ * The mapping lives as long as the object; pointers into data() must not
+ * outlive it. Move-only.
+ */
+class MappedFile {
+public:
+    MappedFile();
+    ~MappedFile();
+
+    MappedFile(MappedFile&& other) noexcept;
+    MappedFile& operator=(MappedFile&& other) noexcept;
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    // Map a whole file; false if it cannot be opened or is empty
+    bool open(const std::string& path);
+    void close();
+
+    bool isOpen() const { return mapped != nullptr; }
+    const unsigned char* data() const { return static_cast<const unsigned char*>(mapped); }
+    size_t size() const { return length; }
+
+private:
+    void* mapped;
+    size_t length;
+
+#ifdef _WIN32
+    void* fileHandle;
+    void* mappingHandle;
+#endif
+};
+
+#endif // MAPPED_FILE_H
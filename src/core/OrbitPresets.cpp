@@ -1,6 +1,5 @@
 #include "OrbitPresets.h"
 #include <cmath>
-#include "raylib.h"
 
 #ifndef M_PI
 #define M_PI 3.14159265358979323846
@@ -80,7 +79,7 @@ OrbitPreset OrbitPresets::createPreset(OrbitType type, double mu) {
             double period = 2.0 * M_PI * std::sqrt(a*a*a / mu);
             return OrbitPreset(ORBIT_ISS, "ISS", 
                              "Low Earth Orbit, 400 km altitude, 51.6° inclination",
-                             state, period, YELLOW);
+                             state, period);
         }
         
         case ORBIT_GEO: {
@@ -89,7 +88,7 @@ OrbitPreset OrbitPresets::createPreset(OrbitType type, double mu) {
             double period = 86164.0; // Sidereal day in seconds
             return OrbitPreset(ORBIT_GEO, "GEO",
                              "Geostationary Orbit, 35,786 km altitude, 0° inclination",
-                             state, period, ORANGE);
+                             state, period);
         }
         
         case ORBIT_MOLNIYA: {
@@ -100,7 +99,7 @@ OrbitPreset OrbitPresets::createPreset(OrbitType type, double mu) {
             double period = 2.0 * M_PI * std::sqrt(a*a*a / mu);
             return OrbitPreset(ORBIT_MOLNIYA, "Molniya",
                              "Highly elliptical, 500-39,900 km, 63.4° inclination",
-                             state, period, RED);
+                             state, period);
         }
         
         case ORBIT_GPS: {
@@ -110,7 +109,7 @@ OrbitPreset OrbitPresets::createPreset(OrbitType type, double mu) {
             double period = 2.0 * M_PI * std::sqrt(a*a*a / mu);
             return OrbitPreset(ORBIT_GPS, "GPS",
                              "Medium Earth Orbit, 20,200 km altitude, 55° inclination",
-                             state, period, GREEN);
+                             state, period);
         }
         
         case ORBIT_SUNSYNC: {
@@ -120,7 +119,7 @@ OrbitPreset OrbitPresets::createPreset(OrbitType type, double mu) {
             double period = 2.0 * M_PI * std::sqrt(a*a*a / mu);
             return OrbitPreset(ORBIT_SUNSYNC, "Sun-Sync",
                              "Sun-Synchronous, 600 km altitude, 98° inclination",
-                             state, period, SKYBLUE);
+                             state, period);
         }
         
         case ORBIT_POLAR: {
@@ -130,7 +129,7 @@ OrbitPreset OrbitPresets::createPreset(OrbitType type, double mu) {
             double period = 2.0 * M_PI * std::sqrt(a*a*a / mu);
             return OrbitPreset(ORBIT_POLAR, "Polar",
                              "Polar Orbit, 600 km altitude, 90° inclination",
-                             state, period, PURPLE);
+                             state, period);
         }
         
         case ORBIT_TUNDRA: {
@@ -141,7 +140,7 @@ OrbitPreset OrbitPresets::createPreset(OrbitType type, double mu) {
             double period = 2.0 * M_PI * std::sqrt(a*a*a / mu);
             return OrbitPreset(ORBIT_TUNDRA, "Tundra",
                              "Tundra Orbit, 20,000-46,000 km, 63.4° incl, 24h period",
-                             state, period, PINK);
+                             state, period);
         }
         
         case ORBIT_GTO: {
@@ -152,7 +151,7 @@ OrbitPreset OrbitPresets::createPreset(OrbitType type, double mu) {
             double period = 2.0 * M_PI * std::sqrt(a*a*a / mu);
             return OrbitPreset(ORBIT_GTO, "GTO",
                              "Geostationary Transfer, 200-35,786 km, 7° inclination",
-                             state, period, LIME);
+                             state, period);
         }
         
         case ORBIT_HUBBLE: {
@@ -162,7 +161,7 @@ OrbitPreset OrbitPresets::createPreset(OrbitType type, double mu) {
             double period = 2.0 * M_PI * std::sqrt(a*a*a / mu);
             return OrbitPreset(ORBIT_HUBBLE, "Hubble",
                              "Hubble Space Telescope, 540 km altitude, 28.5° incl",
-                             state, period, GOLD);
+                             state, period);
         }
         
         case ORBIT_STARLINK: {
@@ -172,7 +171,7 @@ OrbitPreset OrbitPresets::createPreset(OrbitType type, double mu) {
             double period = 2.0 * M_PI * std::sqrt(a*a*a / mu);
             return OrbitPreset(ORBIT_STARLINK, "Starlink",
                              "Starlink Constellation, 550 km altitude, 53° incl",
-                             state, period, MAROON);
+                             state, period);
         }
         
         default:
@@ -2,7 +2,6 @@
 #define ORBIT_PRESETS_H
 
 #include "StateVector.h"
-#include "raylib.h"
 #include <string>
 #include <vector>
 
@@ -29,12 +28,11 @@ struct OrbitPreset {
     std::string description;
     StateVector initialState;
     double period;          // Orbital period in seconds
-    Color color;            // Color for visualization
     
     OrbitPreset(OrbitType t, const std::string& n, const std::string& desc, 
-                const StateVector& state, double per, Color col)
+                const StateVector& state, double per)
         : type(t), name(n), description(desc), initialState(state), 
-          period(per), color(col) {}
+          period(per) {}
 };
 
 class OrbitPresets {
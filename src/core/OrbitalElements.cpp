@@ -1,4 +1,6 @@
 #include "OrbitalElements.h"
+#include "KeplerSolver.h"
+#include <algorithm>
 #include <cmath>
 #include <iostream>
 #include <iomanip>
@@ -13,90 +15,239 @@ OrbitalElements::OrbitalElements()
       rightAscension(0.0), argumentOfPeriapsis(0.0), trueAnomaly(0.0),
       periapsis(0.0), apoapsis(0.0), period(0.0) {}
 
+// Angle in [0, 2pi)
+static inline double wrapAngle(double angle) {
+    return (angle < 0.0) ? angle + 2.0 * M_PI : angle;
+}
+
+// Shared body of the scalar and batch conversions. Angles come from atan2 of
+// sine/cosine pairs, which is exact in every quadrant and needs none of the
+// acos branch fix-ups.
+static inline void elementsFromState(const Vector3D& r, const Vector3D& v, double mu,
+                                     OrbitalElements& elements) {
+    double rMag = r.magnitude();
+    
+    // Specific angular momentum and node vector n = z x h
+    Vector3D h = r.cross(v);
+    double hMag = h.magnitude();
+    Vector3D n(-h.y, h.x, 0.0);
+    double nMag = std::sqrt(n.x * n.x + n.y * n.y);
+    
+    // Eccentricity vector
+    Vector3D eVec = v.cross(h) / mu - r / rMag;
+    double e = eVec.magnitude();
+    elements.eccentricity = e;
+    
+    // Semi-major axis from the specific orbital energy
+    double energy = 0.5 * v.dot(v) - mu / rMag;
+    elements.semiMajorAxis = -mu / (2.0 * energy);
+    
+    elements.inclination = std::atan2(nMag, h.z);
+    
+    bool inclined = nMag > 1e-10;
+    bool eccentric = e > 1e-10;
+    
+    // Right Ascension of Ascending Node (0 for equatorial orbits)
+    elements.rightAscension = inclined ? wrapAngle(std::atan2(n.y, n.x)) : 0.0;
+    
+    // Signed angles in the orbit plane: sin from (a x b) . h_hat, cos from a . b.
+    // Equatorial orbits have no node, so angles are measured from +x in the
+    // direction of motion (mirrored for retrograde orbits), which is what the
+    // perifocal basis in toStateVector expects with RAAN = 0.
+    Vector3D hHat = h / hMag;
+    double motionSign = (h.z < 0.0) ? -1.0 : 1.0;
+    if (!eccentric) {
+        elements.argumentOfPeriapsis = 0.0;
+    } else if (inclined) {
+        elements.argumentOfPeriapsis = wrapAngle(std::atan2(n.cross(eVec).dot(hHat), n.dot(eVec)));
+    } else {
+        // Equatorial eccentric - longitude of periapsis
+        elements.argumentOfPeriapsis = wrapAngle(std::atan2(motionSign * eVec.y, eVec.x));
+    }
+    
+    if (eccentric) {
+        elements.trueAnomaly = wrapAngle(std::atan2(eVec.cross(r).dot(hHat), eVec.dot(r)));
+    } else if (inclined) {
+        // Circular orbit - argument of latitude
+        elements.trueAnomaly = wrapAngle(std::atan2(n.cross(r).dot(hHat), n.dot(r)));
+    } else {
+        // Circular equatorial - true longitude
+        elements.trueAnomaly = wrapAngle(std::atan2(motionSign * r.y, r.x));
+    }
+    
+    // Derived quantities
+    double a = elements.semiMajorAxis;
+    elements.periapsis = a * (1.0 - e);
+    elements.apoapsis = a * (1.0 + e);
+    elements.period = 2.0 * M_PI * std::sqrt(a * a * a / mu);
+}
+
 // Compute orbital elements from Cartesian state vector
 OrbitalElements OrbitalElements::fromStateVector(
     const StateVector& state,
     double mu
 ) {
     OrbitalElements elements;
+    elementsFromState(state.position, state.velocity, mu, elements);
+    return elements;
+}
+
+std::vector<OrbitalElements> OrbitalElements::fromStateVectors(
+    const std::vector<StateVector>& states,
+    double mu
+) {
+    std::vector<OrbitalElements> elements(states.size());
+    for (size_t k = 0; k < states.size(); k++) {
+        elementsFromState(states[k].position, states[k].velocity, mu, elements[k]);
+    }
+    return elements;
+}
+
+// Perifocal basis: P towards periapsis, Q 90 degrees ahead in the orbit plane
+static void perifocalBasis(const OrbitalElements& el, Vector3D& p, Vector3D& q) {
+    double cO = std::cos(el.rightAscension), sO = std::sin(el.rightAscension);
+    double cw = std::cos(el.argumentOfPeriapsis), sw = std::sin(el.argumentOfPeriapsis);
+    double ci = std::cos(el.inclination), si = std::sin(el.inclination);
     
-    Vector3D r = state.position;
-    Vector3D v = state.velocity;
-    
-    double rMag = r.magnitude();
-    double vMag = v.magnitude();
-    
-    // Specific angular momentum vector
-    Vector3D h = r.cross(v);
-    double hMag = h.magnitude();
-    
-    // Node vector (points to ascending node)
-    Vector3D k(0.0, 0.0, 1.0);  // z-axis
-    Vector3D n = k.cross(h);
-    double nMag = n.magnitude();
+    p = Vector3D(cO * cw - sO * sw * ci, sO * cw + cO * sw * ci, sw * si);
+    q = Vector3D(-cO * sw - sO * cw * ci, -sO * sw + cO * cw * ci, cw * si);
+}
+
+// State at true anomaly nu in the perifocal basis
+static StateVector stateAtTrueAnomaly(const OrbitalElements& el, const Vector3D& p, const Vector3D& q,
+                                      double nu, double mu, double time) {
+    double e = el.eccentricity;
+    double semiLatusRectum = el.semiMajorAxis * (1.0 - e * e);
+    double c = std::cos(nu), s = std::sin(nu);
+    double r = semiLatusRectum / (1.0 + e * c);
+    double vScale = std::sqrt(mu / semiLatusRectum);
     
-    // Eccentricity vector
-    Vector3D eVec = (v.cross(h) / mu) - r.normalized();
-    elements.eccentricity = eVec.magnitude();
+    return StateVector((p * c + q * s) * r, (p * -s + q * (e + c)) * vScale, time);
+}
+
+// Mean motion from |a|, so it holds for hyperbolas too
+static inline double meanMotionOf(const OrbitalElements& el, double mu) {
+    double absA = std::abs(el.semiMajorAxis);
+    return std::sqrt(mu / (absA * absA * absA));
+}
+
+StateVector OrbitalElements::toStateVector(double mu, double dt) const {
+    Vector3D p, q;
+    perifocalBasis(*this, p, q);
     
-    // Specific orbital energy
-    double energy = vMag * vMag / 2.0 - mu / rMag;
+    // Same steps as toStateVectors for a single offset, without the arrays
+    double mean = KeplerSolver::meanFromTrue(trueAnomaly, eccentricity) + meanMotionOf(*this, mu) * dt;
+    double nu;
+    if (eccentricity < 1.0) {
+        nu = KeplerSolver::trueFromEccentric(KeplerSolver::solveElliptic(mean, eccentricity), eccentricity);
+    } else {
+        nu = KeplerSolver::trueFromHyperbolic(KeplerSolver::solveHyperbolic(mean, eccentricity), eccentricity);
+    }
+    return stateAtTrueAnomaly(*this, p, q, nu, mu, dt);
+}
+
+std::vector<StateVector> OrbitalElements::toStateVectors(const std::vector<double>& dts, double mu) const {
+    Vector3D p, q;
+    perifocalBasis(*this, p, q);
     
-    // Semi-major axis
-    elements.semiMajorAxis = -mu / (2.0 * energy);
+    // Mean anomaly at every offset, then one batch solve
+    size_t count = dts.size();
+    double meanMotion = meanMotionOf(*this, mu);
+    double meanAtEpoch = KeplerSolver::meanFromTrue(trueAnomaly, eccentricity);
     
-    // Inclination
-    elements.inclination = std::acos(h.z / hMag);
+    std::vector<double> mean(count), ecc(count, eccentricity), anomaly(count);
+    for (size_t k = 0; k < count; k++) {
+        mean[k] = meanAtEpoch + meanMotion * dts[k];
+    }
     
-    // Right Ascension of Ascending Node (RAAN)
-    if (nMag > 1e-10) {
-        elements.rightAscension = std::acos(n.x / nMag);
-        if (n.y < 0.0) {
-            elements.rightAscension = 2.0 * M_PI - elements.rightAscension;
-        }
+    bool elliptic = eccentricity < 1.0;
+    if (elliptic) {
+        KeplerSolver::solveElliptic(mean.data(), ecc.data(), anomaly.data(), count);
     } else {
-        elements.rightAscension = 0.0;  // Equatorial orbit
+        KeplerSolver::solveHyperbolic(mean.data(), ecc.data(), anomaly.data(), count);
     }
     
-    // Argument of periapsis
-    if (nMag > 1e-10 && elements.eccentricity > 1e-10) {
-        elements.argumentOfPeriapsis = std::acos(n.dot(eVec) / (nMag * elements.eccentricity));
-        if (eVec.z < 0.0) {
-            elements.argumentOfPeriapsis = 2.0 * M_PI - elements.argumentOfPeriapsis;
+    std::vector<StateVector> states;
+    states.reserve(count);
+    for (size_t k = 0; k < count; k++) {
+        double nu = elliptic ? KeplerSolver::trueFromEccentric(anomaly[k], eccentricity)
+                             : KeplerSolver::trueFromHyperbolic(anomaly[k], eccentricity);
+        states.push_back(stateAtTrueAnomaly(*this, p, q, nu, mu, dts[k]));
+    }
+    return states;
+}
+
+// Stumpff functions C(z) and S(z) of the universal anomaly
+static void stumpff(double z, double& c, double& s) {
+    if (std::abs(z) < 1.0) {
+        // Series: C = sum (-z)^k / (2k+2)!, S = sum (-z)^k / (2k+3)!
+        c = 0.5;
+        s = 1.0 / 6.0;
+        double termC = c;
+        double termS = s;
+        for (int k = 1; k < 20; k++) {
+            termC *= -z / ((2 * k + 1) * (2 * k + 2));
+            termS *= -z / ((2 * k + 2) * (2 * k + 3));
+            c += termC;
+            s += termS;
+            if (std::abs(termC) < 1e-18 && std::abs(termS) < 1e-18) break;
         }
+    } else if (z > 0.0) {
+        double x = std::sqrt(z);
+        double half = std::sin(0.5 * x);
+        c = 2.0 * half * half / z;
+        s = (x - std::sin(x)) / (z * x);
     } else {
-        elements.argumentOfPeriapsis = 0.0;
+        double x = std::sqrt(-z);
+        double half = std::sinh(0.5 * x);
+        c = -2.0 * half * half / z;
+        s = (std::sinh(x) - x) / (-z * x);
     }
+}
+
+// Two-body propagation in universal variables
+StateVector OrbitalElements::propagateTwoBody(
+    const StateVector& state,
+    double dt,
+    double mu
+) {
+    const Vector3D& r0 = state.position;
+    const Vector3D& v0 = state.velocity;
     
-    // True anomaly
-    if (elements.eccentricity > 1e-10) {
-        elements.trueAnomaly = std::acos(eVec.dot(r) / (elements.eccentricity * rMag));
-        if (r.dot(v) < 0.0) {
-            elements.trueAnomaly = 2.0 * M_PI - elements.trueAnomaly;
-        }
-    } else {
-        // Circular orbit - use argument of latitude
-        if (nMag > 1e-10) {
-            elements.trueAnomaly = std::acos(n.dot(r) / (nMag * rMag));
-            if (r.z < 0.0) {
-                elements.trueAnomaly = 2.0 * M_PI - elements.trueAnomaly;
-            }
-        } else {
-            elements.trueAnomaly = std::atan2(r.y, r.x);
-            if (elements.trueAnomaly < 0.0) {
-                elements.trueAnomaly += 2.0 * M_PI;
-            }
-        }
+    double r0Mag = r0.magnitude();
+    double sqrtMu = std::sqrt(mu);
+    double sigma0 = r0.dot(v0) / sqrtMu;
+    double alpha = 2.0 / r0Mag - v0.dot(v0) / mu;     // 1/a
+    
+    // Newton iteration on the universal Kepler equation; F'(chi) is the radius
+    double chi = (alpha > 0.0) ? sqrtMu * alpha * dt : sqrtMu * dt / r0Mag;
+    double c = 0.5, s = 1.0 / 6.0, r = r0Mag;
+    for (int i = 0; i < 50; i++) {
+        double chi2 = chi * chi;
+        stumpff(alpha * chi2, c, s);
+        
+        double f = sigma0 * chi2 * c + (1.0 - alpha * r0Mag) * chi2 * chi * s
+                 + r0Mag * chi - sqrtMu * dt;
+        r = sigma0 * chi * (1.0 - alpha * chi2 * s) + (1.0 - alpha * r0Mag) * chi2 * c + r0Mag;
+        
+        double delta = f / r;
+        chi -= delta;
+        if (std::abs(delta) <= 1e-15 * std::max(1.0, std::abs(chi))) break;
     }
     
-    // Derived quantities
-    elements.periapsis = elements.semiMajorAxis * (1.0 - elements.eccentricity);
-    elements.apoapsis = elements.semiMajorAxis * (1.0 + elements.eccentricity);
-    elements.period = 2.0 * M_PI * std::sqrt(
-        elements.semiMajorAxis * elements.semiMajorAxis * elements.semiMajorAxis / mu
-    );
+    // Lagrange coefficients at the converged anomaly
+    double chi2 = chi * chi;
+    stumpff(alpha * chi2, c, s);
+    double f = 1.0 - chi2 / r0Mag * c;
+    double g = dt - chi2 * chi / sqrtMu * s;
+    Vector3D position = r0 * f + v0 * g;
     
-    return elements;
+    double rMag = position.magnitude();
+    double fDot = sqrtMu / (rMag * r0Mag) * chi * (alpha * chi2 * s - 1.0);
+    double gDot = 1.0 - chi2 / rMag * c;
+    Vector3D velocity = r0 * fDot + v0 * gDot;
+    
+    return StateVector(position, velocity, state.time + dt);
 }
 
 // Convert to degrees
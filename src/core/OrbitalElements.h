@@ -3,6 +3,7 @@
 
 #include "StateVector.h"
 #include <string>
+#include <vector>
 
 /**
  * Classical Orbital Elements (Keplerian Elements)
@@ -14,7 +15,7 @@ public:
     double eccentricity;         // e (dimensionless)
     double inclination;          // i (radians)
     double rightAscension;       // Ω - RAAN (radians)
-    double argumentOfPeriapsis;  // ω (radians)
+    double argumentOfPeriapsis;  // ω (radians); longitude of periapsis if equatorial
     double trueAnomaly;          // ν (radians)
     
     // Derived quantities
@@ -31,6 +32,27 @@ public:
         double mu
     );
     
+    // Elements of every state in a trajectory or constellation
+    static std::vector<OrbitalElements> fromStateVectors(
+        const std::vector<StateVector>& states,
+        double mu
+    );
+    
+    // Cartesian state dt seconds after these elements' epoch (two-body motion)
+    StateVector toStateVector(double mu, double dt = 0.0) const;
+    
+    // States at many offsets from the epoch; Kepler's equation is solved
+    // for all of them in one batch
+    std::vector<StateVector> toStateVectors(const std::vector<double>& dts, double mu) const;
+    
+    // Two-body (Kepler) motion of a state over dt seconds, solved in
+    // universal variables so it holds for every conic
+    static StateVector propagateTwoBody(
+        const StateVector& state,
+        double dt,
+        double mu
+    );
+    
     // Convert angles to degrees for display
     double inclinationDeg() const;
     double raanDeg() const;
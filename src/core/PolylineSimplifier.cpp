@@ -0,0 +1,68 @@
+#include "PolylineSimplifier.h"
+#include <algorithm>
+#include <limits>
+
+std::vector<double> PolylineSimplifier::importance(const std::vector<StateVector>& points) {
+    const double infinity = std::numeric_limits<double>::infinity();
+    std::vector<double> rank(points.size(), 0.0);
+    if (points.empty()) return rank;
+
+    rank.front() = infinity;
+    rank.back() = infinity;
+    if (points.size() < 3) return rank;
+
+    // Explicit stack of (first, last, parent rank) spans
+    struct Span {
+        size_t first;
+        size_t last;
+        double limit;
+    };
+    std::vector<Span> stack;
+    stack.push_back({0, points.size() - 1, infinity});
+
+    while (!stack.empty()) {
+        Span span = stack.back();
+        stack.pop_back();
+        if (span.last - span.first < 2) continue;
+
+        const Vector3D& a = points[span.first].position;
+        const Vector3D& b = points[span.last].position;
+
+        size_t farthest = span.first + 1;
+        double maxDistance = -1.0;
+        for (size_t i = span.first + 1; i < span.last; i++) {
+            double distance = segmentDistance(points[i].position, a, b);
+            if (distance > maxDistance) {
+                maxDistance = distance;
+                farthest = i;
+            }
+        }
+
+        // Clamp so a point never survives a tolerance that removed its parent
+        double value = std::min(maxDistance, span.limit);
+        rank[farthest] = value;
+        stack.push_back({span.first, farthest, value});
+        stack.push_back({farthest, span.last, value});
+    }
+
+    return rank;
+}
+
+std::vector<uint32_t> PolylineSimplifier::simplify(const std::vector<double>& importance, double tolerance) {
+    std::vector<uint32_t> kept;
+    for (size_t i = 0; i < importance.size(); i++) {
+        if (importance[i] > tolerance || i == 0 || i + 1 == importance.size()) {
+            kept.push_back(static_cast<uint32_t>(i));
+        }
+    }
+    return kept;
+}
+
+double PolylineSimplifier::segmentDistance(const Vector3D& p, const Vector3D& a, const Vector3D& b) {
+    Vector3D ab = b - a;
+    double lengthSquared = ab.magnitudeSquared();
+    if (lengthSquared <= 0.0) return (p - a).magnitude();
+
+    double t = std::max(0.0, std::min(1.0, (p - a).dot(ab) / lengthSquared));
+    return (p - (a + ab * t)).magnitude();
+}
@@ -0,0 +1,28 @@
+#ifndef POLYLINE_SIMPLIFIER_H
+#define POLYLINE_SIMPLIFIER_H
+
+#include "StateVector.h"
+#include <cstdint>
+#include <vector>
+
+/**
+ * Douglas-Peucker decimation of trajectory polylines.
+ *
+ * importance() runs the subdivision once and records, for every point, the
+ * largest tolerance at which it would still be kept. Any number of detail
+ * levels can then be cut from that ranking; the levels are nested, since the
+ * ranking is clamped so no point outranks the split that introduced it.
+ */
+class PolylineSimplifier {
+public:
+    // Per-point deviation (km) that keeps the point; endpoints are infinite
+    static std::vector<double> importance(const std::vector<StateVector>& points);
+
+    // Indices of points kept at `tolerance` (km), in order, endpoints included
+    static std::vector<uint32_t> simplify(const std::vector<double>& importance, double tolerance);
+
+    // Distance (km) from p to the segment a-b
+    static double segmentDistance(const Vector3D& p, const Vector3D& a, const Vector3D& b);
+};
+
+#endif // POLYLINE_SIMPLIFIER_H
@@ -0,0 +1,182 @@
+#include "Profiler.h"
+#include <algorithm>
+#include <chrono>
+#include <fstream>
+#include <iomanip>
+#include <memory>
+#include <mutex>
+
+namespace {
+    // Events of one thread; overwritten oldest-first once full
+    struct ThreadRing {
+        std::mutex mutex;
+        std::vector<ProfileEvent> events;
+        uint64_t written = 0;      // Total events ever recorded
+        uint64_t read = 0;         // Position of the last collectFrame
+        uint32_t id = 0;
+        std::string threadName;
+        bool inUse = true;
+    };
+
+    struct Registry {
+        std::mutex mutex;
+        std::vector<std::unique_ptr<ThreadRing>> rings;
+        std::vector<ProfileStat> stats;
+    };
+
+    Registry& registry() {
+        static Registry instance;
+        return instance;
+    }
+
+    std::chrono::steady_clock::time_point epoch() {
+        static const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+        return start;
+    }
+
+    // Rings outlive their threads; a finished thread's ring is handed to the next new one
+    struct RingHandle {
+        ThreadRing* ring = nullptr;
+
+        ~RingHandle() {
+            if (!ring) return;
+            std::lock_guard<std::mutex> lock(registry().mutex);
+            ring->inUse = false;
+        }
+    };
+
+    ThreadRing& threadRing() {
+        thread_local RingHandle handle;
+        if (handle.ring) return *handle.ring;
+
+        Registry& reg = registry();
+        std::lock_guard<std::mutex> lock(reg.mutex);
+        for (auto& ring : reg.rings) {
+            if (!ring->inUse) {
+                ring->inUse = true;
+                handle.ring = ring.get();
+                return *handle.ring;
+            }
+        }
+
+        std::unique_ptr<ThreadRing> ring(new ThreadRing());
+        ring->events.resize(Profiler::RING_CAPACITY);
+        ring->id = static_cast<uint32_t>(reg.rings.size());
+        ring->threadName = "Thread " + std::to_string(ring->id);
+        handle.ring = ring.get();
+        reg.rings.push_back(std::move(ring));
+        return *handle.ring;
+    }
+
+    void record(const ProfileEvent& event) {
+        ThreadRing& ring = threadRing();
+        std::lock_guard<std::mutex> lock(ring.mutex);
+        ring.events[ring.written % Profiler::RING_CAPACITY] = event;
+        ring.written++;
+    }
+
+    // Oldest event still held in the ring
+    uint64_t firstRetained(const ThreadRing& ring) {
+        return ring.written > Profiler::RING_CAPACITY ? ring.written - Profiler::RING_CAPACITY : 0;
+    }
+}
+
+uint64_t Profiler::now() {
+    return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now() - epoch()).count());
+}
+
+void Profiler::recordScope(const char* name, uint64_t start, uint64_t duration) {
+    record({name, start, duration, 0.0, false});
+}
+
+void Profiler::recordCounter(const char* name, double value) {
+    record({name, now(), 0, value, true});
+}
+
+void Profiler::setThreadName(const char* name) {
+    ThreadRing& ring = threadRing();
+    std::lock_guard<std::mutex> lock(registry().mutex);
+    ring.threadName = name;
+}
+
+void Profiler::collectFrame() {
+    Registry& reg = registry();
+    std::lock_guard<std::mutex> lock(reg.mutex);
+
+    size_t known = reg.stats.size();
+    std::vector<double> frameMs(known, 0.0);
+    for (auto& stat : reg.stats) {
+        stat.calls = 0;
+        stat.maxMs = 0.0;
+    }
+
+    for (auto& ring : reg.rings) {
+        std::lock_guard<std::mutex> ringLock(ring->mutex);
+        for (uint64_t i = std::max(ring->read, firstRetained(*ring)); i < ring->written; i++) {
+            const ProfileEvent& event = ring->events[i % RING_CAPACITY];
+
+            size_t index = 0;
+            while (index < reg.stats.size() && reg.stats[index].name != event.name) index++;
+            if (index == reg.stats.size()) {
+                reg.stats.push_back({event.name, 0.0, 0.0, 0, event.counter, 0.0});
+                frameMs.push_back(0.0);
+            }
+
+            ProfileStat& stat = reg.stats[index];
+            double ms = event.duration * 1e-6;
+            stat.calls++;
+            stat.maxMs = std::max(stat.maxMs, ms);
+            stat.value = event.value;
+            frameMs[index] += ms;
+        }
+        ring->read = ring->written;
+    }
+
+    // New names start at their first frame's value instead of ramping up from zero
+    for (size_t i = 0; i < reg.stats.size(); i++) {
+        ProfileStat& stat = reg.stats[i];
+        stat.msPerFrame = (i < known)
+            ? (1.0 - SMOOTHING) * stat.msPerFrame + SMOOTHING * frameMs[i]
+            : frameMs[i];
+    }
+}
+
+std::vector<ProfileStat> Profiler::frameStats() {
+    std::lock_guard<std::mutex> lock(registry().mutex);
+    return registry().stats;
+}
+
+bool Profiler::exportChromeTrace(const std::string& path) {
+    std::ofstream file(path);
+    if (!file) return false;
+    file << std::fixed << std::setprecision(3);
+
+    Registry& reg = registry();
+    std::lock_guard<std::mutex> lock(reg.mutex);
+
+    // Timestamps and durations are in microseconds
+    file << "{\"displayTimeUnit\": \"ms\", \"traceEvents\": [";
+    bool first = true;
+    for (auto& ring : reg.rings) {
+        std::lock_guard<std::mutex> ringLock(ring->mutex);
+
+        file << (first ? "" : ",") << "\n  {\"name\": \"thread_name\", \"ph\": \"M\", \"pid\": 1, \"tid\": "
+             << ring->id << ", \"args\": {\"name\": \"" << ring->threadName << "\"}}";
+        first = false;
+
+        for (uint64_t i = firstRetained(*ring); i < ring->written; i++) {
+            const ProfileEvent& event = ring->events[i % RING_CAPACITY];
+            file << ",\n  {\"name\": \"" << event.name << "\", \"pid\": 1, \"tid\": " << ring->id
+                 << ", \"ts\": " << event.start * 1e-3;
+            if (event.counter) {
+                file << ", \"ph\": \"C\", \"args\": {\"value\": " << event.value << "}}";
+            } else {
+                file << ", \"ph\": \"X\", \"dur\": " << event.duration * 1e-3 << "}";
+            }
+        }
+    }
+    file << "\n]}\n";
+
+    return static_cast<bool>(file);
+}
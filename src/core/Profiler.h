@@ -0,0 +1,88 @@
+#ifndef PROFILER_H
+#define PROFILER_H
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// Compile every probe out with -DMDV_PROFILE=0 (CMake: MDV_ENABLE_PROFILING=OFF)
+#ifndef MDV_PROFILE
+#define MDV_PROFILE 1
+#endif
+
+// One recorded scope or counter sample
+struct ProfileEvent {
+    const char* name;    // String literal; stored by pointer
+    uint64_t start;      // ns since the profiler epoch
+    uint64_t duration;   // ns (0 for counters)
+    double value;        // Counter value
+    bool counter;
+};
+
+// Per-name aggregate shown by the overlay
+struct ProfileStat {
+    std::string name;
+    double msPerFrame;   // Smoothed total time per frame, all threads
+    double maxMs;        // Longest single call in the last frame
+    uint32_t calls;      // Calls in the last frame
+    bool counter;
+    double value;        // Last counter value
+};
+
+/**
+ * Lightweight hot-path profiler.
+ *
+ * Scopes and counters go into a ring buffer owned by the recording thread,
+ * so probes never contend with each other. The main thread drains all rings
+ * once per frame to build the overlay statistics; whatever is still in the
+ * rings can be written as Chrome trace JSON (chrome://tracing, Perfetto).
+ */
+class Profiler {
+public:
+    static constexpr size_t RING_CAPACITY = 16384;   // Events per thread
+    static constexpr double SMOOTHING = 0.1;         // EMA weight of the newest frame
+
+    // Nanoseconds since the profiler epoch (steady clock)
+    static uint64_t now();
+
+    static void recordScope(const char* name, uint64_t start, uint64_t duration);
+    static void recordCounter(const char* name, double value);
+
+    // Label the calling thread in traces (e.g. "Main", "Simulation")
+    static void setThreadName(const char* name);
+
+    // Drain events recorded since the last call; main thread, once per frame
+    static void collectFrame();
+
+    // Statistics from the last collectFrame, in first-seen order
+    static std::vector<ProfileStat> frameStats();
+
+    // Write every event still held in the rings; false on I/O failure
+    static bool exportChromeTrace(const std::string& path);
+};
+
+// RAII timer behind MDV_PROFILE_SCOPE
+class ProfileScope {
+public:
+    explicit ProfileScope(const char* name) : name(name), start(Profiler::now()) {}
+    ~ProfileScope() { Profiler::recordScope(name, start, Profiler::now() - start); }
+
+    ProfileScope(const ProfileScope&) = delete;
+    ProfileScope& operator=(const ProfileScope&) = delete;
+
+private:
+    const char* name;
+    uint64_t start;
+};
+
+#if MDV_PROFILE
+#define MDV_PROFILE_JOIN_(a, b) a##b
+#define MDV_PROFILE_JOIN(a, b) MDV_PROFILE_JOIN_(a, b)
+#define MDV_PROFILE_SCOPE(name) ProfileScope MDV_PROFILE_JOIN(profileScope_, __LINE__)(name)
+#define MDV_PROFILE_COUNTER(name, value) Profiler::recordCounter(name, static_cast<double>(value))
+#else
+#define MDV_PROFILE_SCOPE(name) ((void)0)
+#define MDV_PROFILE_COUNTER(name, value) ((void)sizeof(value))
+#endif
+
+#endif // PROFILER_H
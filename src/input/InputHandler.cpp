@@ -12,10 +12,15 @@ void InputHandler::processInput(
     bool& earthRotation,
     ForceModel& forceModel  // NEW PARAMETER
 ) {
+    handleSatelliteList(satellites, activeSatelliteIndex, ui);
+    
+    // While typing a search, keys go to the search box only
+    if (handleSatelliteSearch(ui)) return;
+    
     handleAnimationControls(animationSpeed);
     handleCameraControls(camera);
-    handleSatelliteToggle(satellites);
-    handleSatelliteBulkControls(satellites, activeSatelliteIndex);
+    handleSatelliteToggle(satellites, ui);
+    handleSatelliteBulkControls(satellites, activeSatelliteIndex, ui);
     handleSatelliteCycle(satellites, activeSatelliteIndex, camera);
     handleUIToggles(ui, showGrids, earthRotation);
     handleForceModelToggles(forceModel);  // NEW CALL
@@ -52,42 +57,78 @@ void InputHandler::handleCameraControls(CameraController& camera) {
     }
 }
 
-void InputHandler::handleSatelliteToggle(std::vector<Satellite>& satellites) {
-    if (IsKeyPressed(KEY_Q) && satellites.size() > 0) 
-        satellites[0].setVisible(!satellites[0].isVisible());
-    if (IsKeyPressed(KEY_W) && satellites.size() > 1) 
-        satellites[1].setVisible(!satellites[1].isVisible());
-    if (IsKeyPressed(KEY_A) && satellites.size() > 2) 
-        satellites[2].setVisible(!satellites[2].isVisible());
-    if (IsKeyPressed(KEY_S) && satellites.size() > 3) 
-        satellites[3].setVisible(!satellites[3].isVisible());
-    if (IsKeyPressed(KEY_D) && satellites.size() > 4) 
-        satellites[4].setVisible(!satellites[4].isVisible());
-    if (IsKeyPressed(KEY_H) && satellites.size() > 5) 
-        satellites[5].setVisible(!satellites[5].isVisible());
-    if (IsKeyPressed(KEY_J) && satellites.size() > 6) 
-        satellites[6].setVisible(!satellites[6].isVisible());
-    if (IsKeyPressed(KEY_K) && satellites.size() > 7) 
-        satellites[7].setVisible(!satellites[7].isVisible());
-    if (IsKeyPressed(KEY_L) && satellites.size() > 8) 
-        satellites[8].setVisible(!satellites[8].isVisible());
-    if (IsKeyPressed(KEY_Z) && satellites.size() > 9) 
-        satellites[9].setVisible(!satellites[9].isVisible());
+bool InputHandler::handleSatelliteSearch(UIManager& ui) {
+    SatelliteListModel& list = ui.getSatelliteList();
+    
+    if (!list.isSearching()) {
+        if (!IsKeyPressed(KEY_SLASH)) return false;
+        list.beginSearch();
+        while (GetCharPressed() > 0) {}    // Drop the '/' itself
+        return true;
+    }
+    
+    int c;
+    while ((c = GetCharPressed()) > 0) {
+        if (c >= 32 && c < 127) list.appendToQuery(static_cast<char>(c));
+    }
+    if (IsKeyPressed(KEY_BACKSPACE)) list.eraseFromQuery();
+    if (IsKeyPressed(KEY_ENTER)) list.endSearch();
+    return true;
+}
+
+void InputHandler::handleSatelliteList(
+    std::vector<Satellite>& satellites,
+    size_t& activeSatelliteIndex,
+    UIManager& ui
+) {
+    SatelliteListModel& list = ui.getSatelliteList();
+    
+    // Click a row to make it the active satellite
+    size_t clicked;
+    if (IsMouseButtonPressed(MOUSE_BUTTON_LEFT) && ui.satelliteAt(GetMousePosition(), clicked)) {
+        activeSatelliteIndex = clicked;
+        satellites[clicked].setVisible(true);
+    }
+    
+    if (IsKeyPressed(KEY_PAGE_UP)) list.scroll(-(int)SatelliteListModel::VISIBLE_ROWS);
+    if (IsKeyPressed(KEY_PAGE_DOWN)) list.scroll((int)SatelliteListModel::VISIBLE_ROWS);
+    
+    if (IsKeyPressed(KEY_F5)) list.toggleFamily(OrbitFamily::LEO);
+    if (IsKeyPressed(KEY_F6)) list.toggleFamily(OrbitFamily::MEO);
+    if (IsKeyPressed(KEY_F7)) list.toggleFamily(OrbitFamily::HEO);
+    if (IsKeyPressed(KEY_F8)) list.toggleFamily(OrbitFamily::GEO);
+}
+
+void InputHandler::handleSatelliteToggle(std::vector<Satellite>& satellites, UIManager& ui) {
+    // Keys toggle the rows currently shown in the list, top to bottom
+    static const int rowKeys[] = {KEY_Q, KEY_W, KEY_A, KEY_S, KEY_D, KEY_H, KEY_J, KEY_K, KEY_L, KEY_Z};
+    
+    for (size_t row = 0; row < sizeof(rowKeys) / sizeof(rowKeys[0]); row++) {
+        if (!IsKeyPressed(rowKeys[row])) continue;
+        
+        size_t i = ui.getSatelliteList().satelliteAtRow(row);
+        if (i < satellites.size()) {
+            satellites[i].setVisible(!satellites[i].isVisible());
+        }
+    }
 }
 
 void InputHandler::handleSatelliteBulkControls(
     std::vector<Satellite>& satellites, 
-    size_t activeSatelliteIndex
+    size_t activeSatelliteIndex,
+    UIManager& ui
 ) {
     if (IsKeyDown(KEY_LEFT_CONTROL) || IsKeyDown(KEY_RIGHT_CONTROL)) {
+        // Show / hide act on every satellite passing the search and filter
+        const std::vector<uint32_t>& listed = ui.getSatelliteList().getRows();
         if (IsKeyPressed(KEY_V)) {
-            for (auto& sat : satellites) {
-                sat.setVisible(true);
+            for (uint32_t i : listed) {
+                satellites[i].setVisible(true);
             }
         }
         if (IsKeyPressed(KEY_B)) {
-            for (auto& sat : satellites) {
-                sat.setVisible(false);
+            for (uint32_t i : listed) {
+                satellites[i].setVisible(false);
             }
         }
         if (IsKeyPressed(KEY_N)) {
@@ -121,14 +162,29 @@ void InputHandler::handleUIToggles(UIManager& ui, bool& showGrids, bool& earthRo
     if (IsKeyPressed(KEY_R)) earthRotation = !earthRotation;
     if (IsKeyPressed(KEY_V)) ui.toggleEclipse();
     if (IsKeyPressed(KEY_Y)) ui.toggleSolar();
+    if (IsKeyPressed(KEY_P)) ui.toggleProfiler();
+    if (IsKeyPressed(KEY_F3)) traceExportRequested = true;
 }
 
 // NEW FUNCTION - Handle force model toggles
 void InputHandler::handleForceModelToggles(ForceModel& forceModel) {
     if (IsKeyPressed(KEY_M)) {
         forceModel.j2Perturbation = !forceModel.j2Perturbation;
+        forceModelChanged = true;
     }
     
     // Future: Add more force model toggles here
     // if (IsKeyPressed(KEY_N)) { forceModel.atmosphericDrag = !forceModel.atmosphericDrag; }
+}
+
+bool InputHandler::consumeForceModelChange() {
+    bool changed = forceModelChanged;
+    forceModelChanged = false;
+    return changed;
+}
+
+bool InputHandler::consumeTraceExportRequest() {
+    bool requested = traceExportRequested;
+    traceExportRequested = false;
+    return requested;
 }
\ No newline at end of file
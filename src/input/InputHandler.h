@@ -22,11 +22,22 @@ public:
         ForceModel& forceModel
     );
     
+    // True once after the force model was toggled (triggers re-propagation)
+    bool consumeForceModelChange();
+    
+    // True once after a profiler trace export was requested
+    bool consumeTraceExportRequest();
+    
 private:
+    bool forceModelChanged = false;
+    bool traceExportRequested = false;
+    
     void handleAnimationControls(float& animationSpeed);
     void handleCameraControls(CameraController& camera);
-    void handleSatelliteToggle(std::vector<Satellite>& satellites);
-    void handleSatelliteBulkControls(std::vector<Satellite>& satellites, size_t activeSatelliteIndex);
+    bool handleSatelliteSearch(UIManager& ui);
+    void handleSatelliteList(std::vector<Satellite>& satellites, size_t& activeSatelliteIndex, UIManager& ui);
+    void handleSatelliteToggle(std::vector<Satellite>& satellites, UIManager& ui);
+    void handleSatelliteBulkControls(std::vector<Satellite>& satellites, size_t activeSatelliteIndex, UIManager& ui);
     void handleSatelliteCycle(std::vector<Satellite>& satellites, size_t& activeSatelliteIndex, CameraController& camera);
     void handleUIToggles(UIManager& ui, bool& showGrids, bool& earthRotation);
     void handleForceModelToggles(ForceModel& forceModel);
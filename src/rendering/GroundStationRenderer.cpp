@@ -1,5 +1,6 @@
 #include "GroundStationRenderer.h"
 #include "RenderUtils.h"
+#include "Palette.h"
 #include "Constants.h"
 #include "GroundTrack.h"
 #include <cmath>
@@ -32,20 +33,20 @@ void GroundStationRenderer::drawGroundStation(
     pos.z *= offset;
     
     // Draw station marker 
-    DrawSphere(pos, 0.15f, station.color);  
+    DrawSphere(pos, 0.15f, Palette::stationColor(station));  
     // Draw station antenna (small vertical line)
     Vector3 antennaTop = {
         pos.x * 1.02f, 
         pos.y * 1.02f,
         pos.z * 1.02f
     };
-    DrawLine3D(pos, antennaTop, Fade(station.color, 0.8f));
+    DrawLine3D(pos, antennaTop, Fade(Palette::stationColor(station), 0.8f));
     
     // Draw small circle around station 
     DrawCircle3D(pos, 0.2f,  
                  Vector3{pos.x, pos.y, pos.z}, 
                  0.0f, 
-                 Fade(station.color, 0.5f));
+                 Fade(Palette::stationColor(station), 0.5f));
     
 }
 
@@ -72,7 +73,7 @@ void GroundStationRenderer::drawCommunicationCone(
         station.location.latitude,
         station.location.longitude,
         radiusKm,
-        Fade(station.color, 0.2f),
+        Fade(Palette::stationColor(station), 0.2f),
         segments,
         earthRadius
     );
@@ -104,7 +105,7 @@ void GroundStationRenderer::drawLineOfSight(
     Vector3 satPos = RenderUtils::toRaylib(satellite.getCurrentState().position);
     
     // Draw line of sight
-    Color lineColor = Fade(station.color, 0.6f);
+    Color lineColor = Fade(Palette::stationColor(station), 0.6f);
     DrawLine3D(stationPos, satPos, lineColor);
     
     // Draw small marker at midpoint
@@ -168,7 +169,7 @@ void GroundStationRenderer::drawAccessVisualization(
         DrawCircle3D(pos, pulseSize, 
                      Vector3{pos.x, pos.y, pos.z}, 
                      0.0f, 
-                     Fade(station.color, 0.6f));
+                     Fade(Palette::stationColor(station), 0.6f));
     }
 }
 
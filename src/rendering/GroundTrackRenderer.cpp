@@ -1,6 +1,7 @@
 #include "GroundTrackRenderer.h"
 #include "Constants.h"
 #include "RenderUtils.h"
+#include "Palette.h"
 #include <cmath>
 
 void GroundTrackRenderer::drawGroundTrack(
@@ -12,7 +13,7 @@ void GroundTrackRenderer::drawGroundTrack(
     
     // Calculate ground track for the entire orbit
     std::vector<GeoCoordinate> groundTrack = GroundTrack::calculateGroundTrack(
-        sat.getOrbit(),
+        sat.getOrbit().decode(),
         360  // Sample every degree
     );
     
@@ -129,8 +130,8 @@ void GroundTrackRenderer::drawAllGroundTracks(
         
         bool isActive = (i == activeSatIndex);
         Color trackColor = isActive ? 
-            satellites[i].getStats().familyColor : 
-            Fade(satellites[i].getStats().familyColor, 0.4f);
+            Palette::familyColor(satellites[i].getStats().family) : 
+            Fade(Palette::familyColor(satellites[i].getStats().family), 0.4f);
         
         // Draw ground track
         drawGroundTrack(satellites[i], trackColor, isActive);
@@ -0,0 +1,231 @@
+#include "OrbitLineCache.h"
+#include "RenderUtils.h"
+#include "PolylineSimplifier.h"
+#include "Constants.h"
+#include "rlgl.h"
+#include "raymath.h"
+#include <algorithm>
+
+namespace {
+    const char* VERTEX_SHADER = R"(#version 330
+layout(location = 0) in vec4 pointSide;
+layout(location = 1) in vec3 otherEnd;
+uniform mat4 mvp;
+uniform vec2 viewport;
+uniform float lineWidth;
+void main() {
+    vec4 clip = mvp * vec4(pointSide.xyz, 1.0);
+    vec4 otherClip = mvp * vec4(otherEnd, 1.0);
+
+    // Segment direction in pixels, then offset perpendicular by half the width
+    vec2 screen = clip.xy / clip.w * viewport;
+    vec2 otherScreen = otherClip.xy / otherClip.w * viewport;
+    vec2 dir = otherScreen - screen;
+    dir = (dot(dir, dir) > 1e-12) ? normalize(dir) : vec2(1.0, 0.0);
+    vec2 normal = vec2(-dir.y, dir.x);
+
+    clip.xy += normal * pointSide.w * lineWidth / viewport * clip.w;
+    gl_Position = clip;
+}
+)";
+
+    const char* FRAGMENT_SHADER = R"(#version 330
+uniform vec4 lineColor;
+out vec4 finalColor;
+void main() {
+    finalColor = lineColor;
+}
+)";
+
+    const int VERTICES_PER_SEGMENT = 6;
+
+    // Quad per segment (a, b): two triangles, corners on either side of the line.
+    // The b-end sees the segment reversed, so its side sign is flipped.
+    void appendRibbon(const std::vector<Vector3>& points, const std::vector<uint32_t>& indices,
+                      std::vector<Vector4>& pointSide, std::vector<Vector3>& other) {
+        for (size_t i = 1; i < indices.size(); i++) {
+            const Vector3& a = points[indices[i - 1]];
+            const Vector3& b = points[indices[i]];
+            const Vector4 aLeft{a.x, a.y, a.z, -1.0f}, aRight{a.x, a.y, a.z, 1.0f};
+            const Vector4 bLeft{b.x, b.y, b.z, 1.0f}, bRight{b.x, b.y, b.z, -1.0f};
+
+            pointSide.insert(pointSide.end(), {aLeft, aRight, bRight, aLeft, bRight, bLeft});
+            other.insert(other.end(), {b, b, a, b, a, a});
+        }
+    }
+}
+
+OrbitLineCache::OrbitLineCache()
+    : shader{}, mvpLocation(-1), viewportLocation(-1), widthLocation(-1), colorLocation(-1),
+      loaded(false), available(false) {}
+
+OrbitLineCache::~OrbitLineCache() {
+    unload();
+}
+
+void OrbitLineCache::load() {
+    if (loaded) return;
+
+    shader = LoadShaderFromMemory(VERTEX_SHADER, FRAGMENT_SHADER);
+    loaded = true;
+
+    // raylib hands back its default shader when compilation fails
+    available = (shader.id != 0 && shader.id != rlGetShaderIdDefault());
+    if (available) {
+        mvpLocation = GetShaderLocation(shader, "mvp");
+        viewportLocation = GetShaderLocation(shader, "viewport");
+        widthLocation = GetShaderLocation(shader, "lineWidth");
+        colorLocation = GetShaderLocation(shader, "lineColor");
+    }
+}
+
+void OrbitLineCache::unload() {
+    if (!loaded) return;
+
+    for (auto& entry : entries) {
+        release(entry);
+    }
+    entries.clear();
+
+    UnloadShader(shader);
+    loaded = false;
+    available = false;
+}
+
+void OrbitLineCache::draw(size_t index, const Satellite& sat, Color color, float widthPixels,
+                          const ViewCuller& culler) {
+    if (!available) {
+        drawFallback(sat.getOrbit(), color);
+        return;
+    }
+
+    if (index >= entries.size()) entries.resize(index + 1);
+    Entry& entry = entries[index];
+
+    // Holding the uploaded shared_ptr keeps the comparison free of address reuse
+    std::shared_ptr<const CompactTrajectory> trajectory = sat.getTrajectory();
+    if (entry.source != trajectory) {
+        upload(entry, trajectory);
+    }
+    if (entry.levels.empty()) return;
+    if (!culler.isVisible(entry.center, entry.radius)) return;
+
+    const Level& level = selectLevel(entry, culler.getCameraPosition());
+
+    // Flush queued immediate-mode geometry so draw order is preserved
+    rlDrawRenderBatchActive();
+
+    Matrix modelView = MatrixMultiply(rlGetMatrixTransform(), rlGetMatrixModelview());
+    Matrix mvp = MatrixMultiply(modelView, rlGetMatrixProjection());
+    float viewport[2] = {(float)GetScreenWidth(), (float)GetScreenHeight()};
+    float rgba[4] = {color.r / 255.0f, color.g / 255.0f, color.b / 255.0f, color.a / 255.0f};
+
+    rlEnableShader(shader.id);
+    rlSetUniformMatrix(mvpLocation, mvp);
+    rlSetUniform(viewportLocation, viewport, RL_SHADER_UNIFORM_VEC2, 1);
+    rlSetUniform(widthLocation, &widthPixels, RL_SHADER_UNIFORM_FLOAT, 1);
+    rlSetUniform(colorLocation, rgba, RL_SHADER_UNIFORM_VEC4, 1);
+
+    // Ribbon winding flips with the view direction
+    rlDisableBackfaceCulling();
+    rlEnableVertexArray(entry.vao);
+    rlDrawVertexArray(level.first, level.count);
+    rlDisableVertexArray();
+    rlEnableBackfaceCulling();
+    rlDisableShader();
+}
+
+void OrbitLineCache::upload(Entry& entry, std::shared_ptr<const CompactTrajectory> trajectory) {
+    release(entry);
+    entry.source = std::move(trajectory);
+    if (entry.source->size() < 2) return;
+
+    std::vector<StateVector> orbit = entry.source->decode();
+
+    std::vector<Vector3> points(orbit.size());
+    Vector3 sum{0.0f, 0.0f, 0.0f};
+    for (size_t i = 0; i < orbit.size(); i++) {
+        points[i] = RenderUtils::toRaylib(orbit[i].position);
+        sum = Vector3Add(sum, points[i]);
+    }
+    entry.center = Vector3Scale(sum, 1.0f / points.size());
+    for (const Vector3& p : points) {
+        entry.radius = std::max(entry.radius, Vector3Distance(p, entry.center));
+    }
+
+    // Full resolution, then one level per doubling of the tolerance
+    std::vector<double> rank = PolylineSimplifier::importance(orbit);
+    std::vector<Vector4> pointSide;
+    std::vector<Vector3> other;
+
+    std::vector<uint32_t> all(points.size());
+    for (size_t i = 0; i < all.size(); i++) all[i] = static_cast<uint32_t>(i);
+    appendRibbon(points, all, pointSide, other);
+    entry.levels.push_back({0, static_cast<int>(pointSide.size()), 0.0f});
+
+    size_t previousCount = points.size();
+    for (double tolerance = LOD_BASE_TOLERANCE; previousCount > LOD_MIN_POINTS; tolerance *= 2.0) {
+        std::vector<uint32_t> kept = PolylineSimplifier::simplify(rank, tolerance);
+        if (kept.size() == previousCount) continue;
+        if (kept.size() < 3) break;
+
+        int first = static_cast<int>(pointSide.size());
+        appendRibbon(points, kept, pointSide, other);
+        entry.levels.push_back({first, static_cast<int>(pointSide.size()) - first,
+                                RenderUtils::toRenderScale(tolerance)});
+        previousCount = kept.size();
+    }
+
+    entry.vao = rlLoadVertexArray();
+    rlEnableVertexArray(entry.vao);
+
+    entry.pointBuffer = rlLoadVertexBuffer(pointSide.data(), (int)(pointSide.size() * sizeof(Vector4)), false);
+    rlSetVertexAttribute(0, 4, RL_FLOAT, false, 0, 0);
+    rlEnableVertexAttribute(0);
+
+    entry.otherBuffer = rlLoadVertexBuffer(other.data(), (int)(other.size() * sizeof(Vector3)), false);
+    rlSetVertexAttribute(1, 3, RL_FLOAT, false, 0, 0);
+    rlEnableVertexAttribute(1);
+
+    rlDisableVertexArray();
+}
+
+void OrbitLineCache::release(Entry& entry) {
+    if (entry.pointBuffer) rlUnloadVertexBuffer(entry.pointBuffer);
+    if (entry.otherBuffer) rlUnloadVertexBuffer(entry.otherBuffer);
+    if (entry.vao) rlUnloadVertexArray(entry.vao);
+    entry = Entry();
+}
+
+const OrbitLineCache::Level& OrbitLineCache::selectLevel(const Entry& entry, Vector3 camera) {
+    Matrix projection = rlGetMatrixProjection();
+
+    // Pixels per render unit at the orbit's closest possible distance
+    float pixelsPerUnit;
+    float halfHeight = 0.5f * GetScreenHeight();
+    if (projection.m15 == 0.0f) {
+        float distance = std::max(Vector3Distance(camera, entry.center) - entry.radius, 1e-3f);
+        pixelsPerUnit = projection.m5 * halfHeight / distance;
+    } else {
+        pixelsPerUnit = projection.m5 * halfHeight;    // Orthographic
+    }
+
+    size_t chosen = 0;
+    for (size_t i = 1; i < entry.levels.size(); i++) {
+        if (entry.levels[i].tolerance * pixelsPerUnit > ORBIT_LOD_PIXEL_ERROR) break;
+        chosen = i;
+    }
+    return entry.levels[chosen];
+}
+
+void OrbitLineCache::drawFallback(const CompactTrajectory& trajectory, Color color) {
+    if (trajectory.size() < 2) return;
+
+    std::vector<StateVector> orbit = trajectory.decode();
+    Vector3 previous = RenderUtils::toRaylib(orbit[0].position);
+    for (size_t i = 1; i < orbit.size(); i++) {
+        Vector3 current = RenderUtils::toRaylib(orbit[i].position);
+        DrawLine3D(previous, current, color);
+        previous = current;
+    }
+}
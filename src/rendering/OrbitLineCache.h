@@ -0,0 +1,81 @@
+#ifndef ORBIT_LINE_CACHE_H
+#define ORBIT_LINE_CACHE_H
+
+#include "Satellite.h"
+#include "CompactTrajectory.h"
+#include "StateVector.h"
+#include "ViewCuller.h"
+#include "raylib.h"
+#include <memory>
+#include <vector>
+
+/**
+ * Orbit polylines kept in static GPU buffers.
+ *
+ * Each trajectory is uploaded once, when it is first drawn or replaced, as
+ * screen-space ribbons: every segment becomes a quad that the vertex shader
+ * widens to a fixed pixel width. Drawing an orbit is then a single call with
+ * no per-point CPU work. Without shader support it falls back to DrawLine3D.
+ *
+ * Every orbit is stored at several Douglas-Peucker detail levels; draw()
+ * picks the coarsest one whose deviation, projected at the orbit's nearest
+ * distance to the camera, stays under ORBIT_LOD_PIXEL_ERROR.
+ */
+class OrbitLineCache {
+public:
+    OrbitLineCache();
+    ~OrbitLineCache();
+
+    void load();
+    void unload();
+
+    // Draw satellite `index`'s orbit, re-uploading it if the trajectory changed;
+    // skipped when its bounding sphere is outside the view
+    void draw(size_t index, const Satellite& sat, Color color, float widthPixels,
+              const ViewCuller& culler);
+
+    bool isAvailable() const { return available; }
+
+private:
+    static constexpr double LOD_BASE_TOLERANCE = 0.5;   // km, finest decimated level
+    static constexpr size_t LOD_MIN_POINTS = 16;        // Coarsest level size
+
+    // Vertex range of one detail level
+    struct Level {
+        int first;
+        int count;
+        float tolerance;    // Max deviation, render units
+    };
+
+    struct Entry {
+        std::shared_ptr<const CompactTrajectory> source;   // Uploaded trajectory
+        unsigned int vao = 0;
+        unsigned int pointBuffer = 0;    // vec4: this end xyz, side (+1/-1)
+        unsigned int otherBuffer = 0;    // vec3: opposite end of the segment
+        std::vector<Level> levels;       // Finest (full resolution) first
+        Vector3 center{0.0f, 0.0f, 0.0f};
+        float radius = 0.0f;             // Bounding sphere, render units
+    };
+
+    Shader shader;
+    int mvpLocation;
+    int viewportLocation;
+    int widthLocation;
+    int colorLocation;
+    bool loaded;
+    bool available;
+
+    std::vector<Entry> entries;
+
+    // Decodes the trajectory once; only the vertex buffers are kept
+    void upload(Entry& entry, std::shared_ptr<const CompactTrajectory> trajectory);
+    void release(Entry& entry);
+
+    // Coarsest level within the pixel error budget for the current 3D view
+    static const Level& selectLevel(const Entry& entry, Vector3 camera);
+
+    // Immediate-mode path (one DrawLine3D per segment)
+    static void drawFallback(const CompactTrajectory& trajectory, Color color);
+};
+
+#endif // ORBIT_LINE_CACHE_H
@@ -1,56 +1,84 @@
 #include "OrbitRenderer.h"
 #include "RenderUtils.h"
+#include "Palette.h"
 #include "Constants.h"
 #include "Eclipse.h"
 #include "OrbitalElements.h"
+#include "Profiler.h"
+#include "raymath.h"
+#include <algorithm>
 
 void OrbitRenderer::drawSatellites(
     const std::vector<Satellite>& satellites,
     size_t activeSatelliteIndex,
-    const Vector3D& sunDirection,
-    bool showEclipse
+    const std::vector<EclipseStatus>& eclipseStates,
+    bool showEclipse,
+    SphereBatch& spheres,
+    OrbitLineCache& orbitLines,
+    const ViewCuller& culler
 ) {
+    const EclipseStatus noEclipse;
+    spheres.clear();
+    
+    // Bounds of every visible satellite and its trail, culled in one pass
+    std::vector<size_t> candidates;
+    std::vector<Vector4> bounds;
     for (size_t i = 0; i < satellites.size(); i++) {
         if (!satellites[i].isVisible()) continue;
         
+        Vector3 pos = RenderUtils::toRaylib(satellites[i].getCurrentState().position);
+        candidates.push_back(i);
+        bounds.push_back(Vector4{pos.x, pos.y, pos.z, 0.4f});
+        bounds.push_back(trailBounds(satellites[i]));
+    }
+    
+    std::vector<uint8_t> onScreen;
+    size_t visibleCount = culler.cullSpheres(bounds, onScreen);
+    MDV_PROFILE_COUNTER("Culled satellite spheres", bounds.size() - visibleCount);
+    
+    for (size_t c = 0; c < candidates.size(); c++) {
+        size_t i = candidates[c];
         bool isActive = (i == activeSatelliteIndex);
         
         // Draw orbit line
-        drawOrbitLine(satellites[i], isActive);
+        drawOrbitLine(satellites[i], i, isActive, orbitLines, culler);
         
         // Draw satellite
-        drawSatellite(satellites[i], isActive, sunDirection, showEclipse);
+        if (onScreen[2 * c]) {
+            const EclipseStatus& eclipse = (i < eclipseStates.size()) ? eclipseStates[i] : noEclipse;
+            drawSatellite(satellites[i], isActive, eclipse, showEclipse, spheres);
+        }
         
         // Draw trail
-        drawTrail(satellites[i]);
+        if (onScreen[2 * c + 1]) {
+            drawTrail(satellites[i], spheres);
+        }
         
         // Draw velocity vector (only for active)
         if (isActive) {
             drawVelocityVector(satellites[i]);
-            drawApsisMarkers(satellites[i], MU_EARTH);
+            drawApsisMarkers(satellites[i], spheres);
         }
     }
+    
+    MDV_PROFILE_COUNTER("Sphere instances", spheres.size());
+    spheres.draw();
 }
 
 void OrbitRenderer::drawSatellite(
     const Satellite& sat,
     bool isActive,
-    const Vector3D& sunDirection,
-    bool showEclipse
+    const EclipseStatus& eclipse,
+    bool showEclipse,
+    SphereBatch& spheres
 ) {
     Vector3 scPos = RenderUtils::toRaylib(sat.getCurrentState().position);
     float satSize = isActive ? 0.4f : 0.25f;
-    Color orbitColor = sat.getPreset().color;
+    Color orbitColor = Palette::presetColor(sat.getPreset().type);
     
     // Check eclipse status
     Color satColor = orbitColor;
     if (showEclipse) {
-        EclipseStatus eclipse = EclipseDetector::checkEclipse(
-            sat.getCurrentState().position,
-            sunDirection,
-            EARTH_RADIUS
-        );
-
         if (eclipse.inUmbra) {
             // Full shadow - darken significantly
             satColor = Color{
@@ -70,36 +98,53 @@ void OrbitRenderer::drawSatellite(
         }
     }
 
-    DrawSphere(scPos, satSize, satColor);
+    spheres.add(scPos, satSize, satColor);
 }
 
 void OrbitRenderer::drawOrbitLine(
     const Satellite& sat,
-    bool isActive
+    size_t index,
+    bool isActive,
+    OrbitLineCache& orbitLines,
+    const ViewCuller& culler
 ) {
     Color lineColor = isActive ? 
-        sat.getStats().familyColor : 
-        Fade(sat.getStats().familyColor, 0.4f);
+        Palette::familyColor(sat.getStats().family) : 
+        Fade(Palette::familyColor(sat.getStats().family), 0.4f);
     
-    for (size_t i = 1; i < sat.getOrbit().size(); i++) {
-        Vector3 p1 = RenderUtils::toRaylib(sat.getOrbit()[i-1].position);
-        Vector3 p2 = RenderUtils::toRaylib(sat.getOrbit()[i].position);
-        DrawLine3D(p1, p2, lineColor);
-    }
+    orbitLines.draw(index, sat, lineColor, isActive ? 1.5f : 1.0f, culler);
 }
 
-void OrbitRenderer::drawTrail(const Satellite& sat) {
+void OrbitRenderer::drawTrail(const Satellite& sat, SphereBatch& spheres) {
     if (sat.getCurrentFrame() <= TRAIL_LENGTH) return;
     
-    Color orbitColor = sat.getPreset().color;
+    Color orbitColor = Palette::presetColor(sat.getPreset().type);
     
-    for (size_t i = sat.getCurrentFrame() - TRAIL_LENGTH; i < sat.getCurrentFrame(); i++) {
-        float alpha = (float)(i - (sat.getCurrentFrame() - TRAIL_LENGTH)) / TRAIL_LENGTH;
-        Vector3 trailPos = RenderUtils::toRaylib(sat.getOrbit()[i].position);
-        DrawSphere(trailPos, 0.1f, Fade(orbitColor, alpha * 0.5f));
+    // TRAIL_LENGTH states, then the satellite's own
+    const std::vector<StateVector>& recent = sat.getRecentStates();
+    for (size_t i = 0; i < TRAIL_LENGTH; i++) {
+        float alpha = (float)i / TRAIL_LENGTH;
+        Vector3 trailPos = RenderUtils::toRaylib(recent[i].position);
+        spheres.add(trailPos, 0.1f, Fade(orbitColor, alpha * 0.5f));
     }
 }
 
+Vector4 OrbitRenderer::trailBounds(const Satellite& sat) {
+    if (sat.getCurrentFrame() <= TRAIL_LENGTH) return Vector4{0.0f, 0.0f, 0.0f, 0.0f};
+    
+    // Trail arcs are short, so every marker lies within the ends' distance of
+    // the middle marker
+    const std::vector<StateVector>& recent = sat.getRecentStates();
+    size_t last = TRAIL_LENGTH - 1;
+    size_t first = 0;
+    Vector3 middle = RenderUtils::toRaylib(recent[(first + last) / 2].position);
+    float radius = std::max(
+        Vector3Distance(middle, RenderUtils::toRaylib(recent[first].position)),
+        Vector3Distance(middle, RenderUtils::toRaylib(recent[last].position)));
+    
+    return Vector4{middle.x, middle.y, middle.z, radius + 0.1f};
+}
+
 void OrbitRenderer::drawVelocityVector(const Satellite& sat, float length) {
     Vector3 scPos = RenderUtils::toRaylib(sat.getCurrentState().position);
     Vector3D velScaled = sat.getCurrentState().velocity.normalized() * length;
@@ -107,34 +152,22 @@ void OrbitRenderer::drawVelocityVector(const Satellite& sat, float length) {
     DrawLine3D(scPos, velEnd, GREEN);
 }
 
-void OrbitRenderer::drawApsisMarkers(const Satellite& sat, double mu) {
-    OrbitalElements elements = OrbitalElements::fromStateVector(
-        sat.getOrbit()[0], 
-        mu
-    );
+void OrbitRenderer::drawApsisMarkers(const Satellite& sat, SphereBatch& spheres) {
+    // Only the shape is needed, so convert one sample, not the whole history
+    const CompactTrajectory& orbit = sat.getOrbit();
+    StateVector periapsis = orbit.state(0);
+    OrbitalElements elements = OrbitalElements::fromStateVector(periapsis, MU_EARTH);
     
     if (elements.eccentricity > 0.01) {
         // Periapsis marker
-        size_t periIdx = 0;
-        DrawSphere(
-            RenderUtils::toRaylib(sat.getOrbit()[periIdx].position), 
-            0.3f, 
-            ORANGE
-        );
+        Vector3 periPos = RenderUtils::toRaylib(periapsis.position);
+        spheres.add(periPos, 0.3f, ORANGE);
         
         // Apoapsis marker
-        size_t apoIdx = sat.getOrbit().size() / 2;
-        DrawSphere(
-            RenderUtils::toRaylib(sat.getOrbit()[apoIdx].position), 
-            0.3f, 
-            PURPLE
-        );
+        Vector3 apoPos = RenderUtils::toRaylib(orbit.state(orbit.size() / 2).position);
+        spheres.add(apoPos, 0.3f, PURPLE);
         
         // Line between apsis points
-        DrawLine3D(
-            RenderUtils::toRaylib(sat.getOrbit()[periIdx].position),
-            RenderUtils::toRaylib(sat.getOrbit()[apoIdx].position),
-            Fade(WHITE, 0.3f)
-        );
+        DrawLine3D(periPos, apoPos, Fade(WHITE, 0.3f));
     }
 }
\ No newline at end of file
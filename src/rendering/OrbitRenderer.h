@@ -4,6 +4,9 @@
 #include "Satellite.h"
 #include "Eclipse.h"
 #include "Vector3D.h"
+#include "SphereBatch.h"
+#include "OrbitLineCache.h"
+#include "ViewCuller.h"
 #include "raylib.h"
 #include <vector>
 
@@ -11,30 +14,41 @@
 class OrbitRenderer {
 public:
     // Draw all visible satellites
+    // (eclipse states come from the simulation snapshot, one per satellite;
+    // satellites and trails are culled against the view in one pass, then
+    // the surviving spheres go out as one instanced batch)
     static void drawSatellites(
         const std::vector<Satellite>& satellites,
         size_t activeSatelliteIndex,
-        const Vector3D& sunDirection,
-        bool showEclipse
+        const std::vector<EclipseStatus>& eclipseStates,
+        bool showEclipse,
+        SphereBatch& spheres,
+        OrbitLineCache& orbitLines,
+        const ViewCuller& culler
     );
     
-    // Draw a single satellite
+    // Queue a single satellite
     static void drawSatellite(
         const Satellite& sat,
         bool isActive,
-        const Vector3D& sunDirection,
-        bool showEclipse
+        const EclipseStatus& eclipse,
+        bool showEclipse,
+        SphereBatch& spheres
     );
     
-    // Draw orbit line
+    // Draw orbit line (one call from the cached GPU buffers)
     static void drawOrbitLine(
         const Satellite& sat,
-        bool isActive
+        size_t index,
+        bool isActive,
+        OrbitLineCache& orbitLines,
+        const ViewCuller& culler
     );
     
-    // Draw satellite trail
+    // Queue satellite trail markers
     static void drawTrail(
-        const Satellite& sat
+        const Satellite& sat,
+        SphereBatch& spheres
     );
     
     // Draw velocity vector
@@ -43,10 +57,15 @@ public:
         float length = 2000.0f
     );
     
+    // Bounding sphere (centre, radius) of the trail markers; radius 0 if no trail
+    static Vector4 trailBounds(
+        const Satellite& sat
+    );
+    
     // Draw periapsis and apoapsis markers
     static void drawApsisMarkers(
         const Satellite& sat,
-        double mu
+        SphereBatch& spheres
     );
 };
 
@@ -0,0 +1,43 @@
+#include "Palette.h"
+
+Color Palette::presetColor(OrbitType type) {
+    switch (type) {
+        case ORBIT_ISS:      return YELLOW;
+        case ORBIT_GEO:      return ORANGE;
+        case ORBIT_MOLNIYA:  return RED;
+        case ORBIT_GPS:      return GREEN;
+        case ORBIT_SUNSYNC:  return SKYBLUE;
+        case ORBIT_POLAR:    return PURPLE;
+        case ORBIT_TUNDRA:   return PINK;
+        case ORBIT_GTO:      return LIME;
+        case ORBIT_HUBBLE:   return GOLD;
+        case ORBIT_STARLINK: return MAROON;
+        default:             return WHITE;
+    }
+}
+
+Color Palette::familyColor(OrbitFamily family) {
+    switch (family) {
+        case OrbitFamily::LEO: return Color{100, 200, 255, 255};
+        case OrbitFamily::MEO: return Color{100, 255, 100, 255};
+        case OrbitFamily::HEO: return Color{255, 150, 100, 255};
+        case OrbitFamily::GEO: return Color{255, 100, 255, 255};
+        default:               return WHITE;
+    }
+}
+
+Color Palette::stationColor(const GroundStation& station) {
+    if (station.code == "JPL") return Color{100, 200, 255, 255};  // Light blue
+    if (station.code == "MAD") return Color{255, 200, 100, 255};  // Light orange
+    if (station.code == "USD") return Color{255, 100, 100, 255};  // Light red
+    if (station.code == "WLP") return Color{100, 255, 100, 255};  // Light green
+    if (station.code == "KOU") return Color{200, 100, 255, 255};  // Light purple
+    return WHITE;
+}
+
+Color Palette::solarEfficiencyColor(double efficiency) {
+    if (efficiency > 0.8) return GREEN;
+    if (efficiency > 0.5) return YELLOW;
+    if (efficiency > 0.2) return ORANGE;
+    return RED;
+}
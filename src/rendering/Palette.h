@@ -0,0 +1,19 @@
+#ifndef PALETTE_H
+#define PALETTE_H
+
+#include "OrbitPresets.h"
+#include "Satellite.h"
+#include "GroundStation.h"
+#include "raylib.h"
+
+// Visualization colors for simulation objects. Kept out of the core and
+// simulation layers so those build without raylib.
+class Palette {
+public:
+    static Color presetColor(OrbitType type);
+    static Color familyColor(OrbitFamily family);
+    static Color stationColor(const GroundStation& station);
+    static Color solarEfficiencyColor(double efficiency);
+};
+
+#endif // PALETTE_H
@@ -0,0 +1,136 @@
+#include "SphereBatch.h"
+#include "rlgl.h"
+#include "raymath.h"
+
+namespace {
+    // Vertex attribute slots for per-instance data (clear of raylib's mesh defaults)
+    const int ATTRIB_INSTANCE_CENTER = 10;
+    const int ATTRIB_INSTANCE_COLOR = 11;
+
+    const char* VERTEX_SHADER = R"(#version 330
+layout(location = 0) in vec3 vertexPosition;
+layout(location = 10) in vec4 instanceCenter;
+layout(location = 11) in vec4 instanceColor;
+uniform mat4 mvp;
+out vec4 fragColor;
+void main() {
+    fragColor = instanceColor;
+    gl_Position = mvp * vec4(instanceCenter.xyz + vertexPosition * instanceCenter.w, 1.0);
+}
+)";
+
+    const char* FRAGMENT_SHADER = R"(#version 330
+in vec4 fragColor;
+out vec4 finalColor;
+void main() {
+    finalColor = fragColor;
+}
+)";
+}
+
+SphereBatch::SphereBatch()
+    : mesh{}, shader{}, mvpLocation(-1), centerBuffer(0), colorBuffer(0),
+      capacity(0), loaded(false), instanced(false) {}
+
+SphereBatch::~SphereBatch() {
+    unload();
+}
+
+void SphereBatch::load() {
+    if (loaded) return;
+
+    // Same tessellation as DrawSphere's default
+    mesh = GenMeshSphere(1.0f, 16, 16);
+    shader = LoadShaderFromMemory(VERTEX_SHADER, FRAGMENT_SHADER);
+    loaded = true;
+
+    // raylib hands back its default shader when compilation fails
+    instanced = (shader.id != 0 && shader.id != rlGetShaderIdDefault() && mesh.vaoId != 0);
+    if (instanced) {
+        mvpLocation = GetShaderLocation(shader, "mvp");
+        allocateBuffers(INITIAL_CAPACITY);
+    }
+}
+
+void SphereBatch::unload() {
+    if (!loaded) return;
+
+    if (centerBuffer) rlUnloadVertexBuffer(centerBuffer);
+    if (colorBuffer) rlUnloadVertexBuffer(colorBuffer);
+    centerBuffer = colorBuffer = 0;
+    capacity = 0;
+
+    UnloadShader(shader);
+    UnloadMesh(mesh);
+    loaded = false;
+    instanced = false;
+}
+
+void SphereBatch::clear() {
+    centers.clear();
+    colors.clear();
+}
+
+void SphereBatch::add(Vector3 center, float radius, Color color) {
+    centers.push_back(Vector4{center.x, center.y, center.z, radius});
+    colors.push_back(color);
+}
+
+void SphereBatch::draw() {
+    if (centers.empty()) return;
+
+    if (!instanced) {
+        for (size_t i = 0; i < centers.size(); i++) {
+            DrawSphere(Vector3{centers[i].x, centers[i].y, centers[i].z}, centers[i].w, colors[i]);
+        }
+        return;
+    }
+
+    if (centers.size() > capacity) {
+        size_t grown = capacity;
+        while (grown < centers.size()) grown *= 2;
+        allocateBuffers(grown);
+    }
+
+    int count = static_cast<int>(centers.size());
+    rlUpdateVertexBuffer(centerBuffer, centers.data(), count * (int)sizeof(Vector4), 0);
+    rlUpdateVertexBuffer(colorBuffer, colors.data(), count * (int)sizeof(Color), 0);
+
+    // Flush immediate-mode geometry queued so far so draw order is preserved
+    rlDrawRenderBatchActive();
+
+    Matrix modelView = MatrixMultiply(rlGetMatrixTransform(), rlGetMatrixModelview());
+    Matrix mvp = MatrixMultiply(modelView, rlGetMatrixProjection());
+
+    rlEnableShader(shader.id);
+    rlSetUniformMatrix(mvpLocation, mvp);
+    rlEnableVertexArray(mesh.vaoId);
+    rlDrawVertexArrayInstanced(0, mesh.vertexCount, count);
+    rlDisableVertexArray();
+    rlDisableShader();
+}
+
+void SphereBatch::allocateBuffers(size_t instanceCount) {
+    if (centerBuffer) rlUnloadVertexBuffer(centerBuffer);
+    if (colorBuffer) rlUnloadVertexBuffer(colorBuffer);
+
+    capacity = instanceCount;
+    centerBuffer = rlLoadVertexBuffer(nullptr, (int)(capacity * sizeof(Vector4)), true);
+    colorBuffer = rlLoadVertexBuffer(nullptr, (int)(capacity * sizeof(Color)), true);
+
+    // Attribute bindings are VAO state, so they only change with the buffers
+    rlEnableVertexArray(mesh.vaoId);
+
+    rlEnableVertexBuffer(centerBuffer);
+    rlSetVertexAttribute(ATTRIB_INSTANCE_CENTER, 4, RL_FLOAT, false, 0, 0);
+    rlEnableVertexAttribute(ATTRIB_INSTANCE_CENTER);
+    rlSetVertexAttributeDivisor(ATTRIB_INSTANCE_CENTER, 1);
+
+    rlEnableVertexBuffer(colorBuffer);
+    rlSetVertexAttribute(ATTRIB_INSTANCE_COLOR, 4, RL_UNSIGNED_BYTE, true, 0, 0);
+    rlEnableVertexAttribute(ATTRIB_INSTANCE_COLOR);
+    rlSetVertexAttributeDivisor(ATTRIB_INSTANCE_COLOR, 1);
+
+    rlDisableVertexBuffer();
+    rlDisableVertexArray();
+}
@@ -0,0 +1,56 @@
+#ifndef SPHERE_BATCH_H
+#define SPHERE_BATCH_H
+
+#include "raylib.h"
+#include <cstddef>
+#include <vector>
+
+/**
+ * Batched sphere rendering for satellites and trail markers.
+ *
+ * Spheres are collected during the frame and drawn with a single instanced
+ * call. Per-instance centre/radius and colour live in persistent GPU buffers
+ * that are only reallocated when the instance count outgrows them. Falls back
+ * to one DrawSphere per instance when the instancing shader is unavailable
+ * (e.g. an OpenGL ES 2 build).
+ */
+class SphereBatch {
+public:
+    SphereBatch();
+    ~SphereBatch();
+
+    // Create the unit sphere mesh, shader and instance buffers
+    void load();
+    void unload();
+
+    // Start a new frame
+    void clear();
+
+    void add(Vector3 center, float radius, Color color);
+
+    // Submit all queued spheres; call inside BeginMode3D
+    void draw();
+
+    size_t size() const { return centers.size(); }
+    bool isInstanced() const { return instanced; }
+
+private:
+    static constexpr size_t INITIAL_CAPACITY = 1024;
+
+    Mesh mesh;
+    Shader shader;
+    int mvpLocation;
+    unsigned int centerBuffer;   // vec4: centre xyz, radius w
+    unsigned int colorBuffer;    // RGBA8
+    size_t capacity;
+    bool loaded;
+    bool instanced;
+
+    std::vector<Vector4> centers;
+    std::vector<Color> colors;
+
+    // (Re)create instance buffers and attach them to the mesh VAO
+    void allocateBuffers(size_t instanceCount);
+};
+
+#endif // SPHERE_BATCH_H
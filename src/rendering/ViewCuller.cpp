@@ -0,0 +1,89 @@
+#include "ViewCuller.h"
+#include "RenderUtils.h"
+#include "Constants.h"
+#include "rlgl.h"
+#include "raymath.h"
+#include <cmath>
+
+namespace {
+    Vector4 normalizePlane(float a, float b, float c, float d) {
+        float length = std::sqrt(a * a + b * b + c * c);
+        if (length <= 0.0f) return Vector4{0.0f, 0.0f, 0.0f, 1.0f};
+        return Vector4{a / length, b / length, c / length, d / length};
+    }
+}
+
+ViewCuller::ViewCuller()
+    : camera{0.0f, 0.0f, 0.0f}, earthRadius(RenderUtils::toRenderScale(EARTH_RADIUS)) {
+    // Until the first update everything passes
+    for (auto& plane : planes) {
+        plane = Vector4{0.0f, 0.0f, 0.0f, 1.0f};
+    }
+}
+
+void ViewCuller::update() {
+    Matrix view = MatrixMultiply(rlGetMatrixTransform(), rlGetMatrixModelview());
+    Matrix m = MatrixMultiply(view, rlGetMatrixProjection());
+
+    // Gribb-Hartmann: planes are sums/differences of the clip matrix rows
+    // (row i is m[i], m[i+4], m[i+8], m[i+12])
+    planes[0] = normalizePlane(m.m3 + m.m0, m.m7 + m.m4, m.m11 + m.m8, m.m15 + m.m12);    // Left
+    planes[1] = normalizePlane(m.m3 - m.m0, m.m7 - m.m4, m.m11 - m.m8, m.m15 - m.m12);    // Right
+    planes[2] = normalizePlane(m.m3 + m.m1, m.m7 + m.m5, m.m11 + m.m9, m.m15 + m.m13);    // Bottom
+    planes[3] = normalizePlane(m.m3 - m.m1, m.m7 - m.m5, m.m11 - m.m9, m.m15 - m.m13);    // Top
+    planes[4] = normalizePlane(m.m3 + m.m2, m.m7 + m.m6, m.m11 + m.m10, m.m15 + m.m14);   // Near
+    planes[5] = normalizePlane(m.m3 - m.m2, m.m7 - m.m6, m.m11 - m.m10, m.m15 - m.m14);   // Far
+
+    // Camera position is -R^T t of the view matrix
+    camera = Vector3{
+        -(view.m0 * view.m12 + view.m1 * view.m13 + view.m2 * view.m14),
+        -(view.m4 * view.m12 + view.m5 * view.m13 + view.m6 * view.m14),
+        -(view.m8 * view.m12 + view.m9 * view.m13 + view.m10 * view.m14)};
+}
+
+bool ViewCuller::inFrustum(Vector3 center, float radius) const {
+    for (const auto& plane : planes) {
+        if (plane.x * center.x + plane.y * center.y + plane.z * center.z + plane.w < -radius) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool ViewCuller::occludedByEarth(Vector3 center, float radius) const {
+    float shrunk = earthRadius - radius;
+    if (shrunk <= 0.0f) return false;
+
+    // Closest approach of the camera->center segment to the Earth's centre
+    Vector3 toTarget = Vector3Subtract(center, camera);
+    Vector3 toEarth = Vector3Scale(camera, -1.0f);
+    float lengthSquared = Vector3DotProduct(toTarget, toTarget);
+    if (lengthSquared <= 0.0f) return false;
+
+    float t = Vector3DotProduct(toEarth, toTarget) / lengthSquared;
+    if (t <= 0.0f || t >= 1.0f) return false;    // Earth is not between camera and target
+
+    Vector3 closest = Vector3Add(camera, Vector3Scale(toTarget, t));
+    return Vector3DotProduct(closest, closest) < shrunk * shrunk;
+}
+
+size_t ViewCuller::cullSpheres(const std::vector<Vector4>& spheres, std::vector<uint8_t>& visible) const {
+    visible.resize(spheres.size());
+    size_t count = 0;
+    for (size_t i = 0; i < spheres.size(); i++) {
+        Vector3 center{spheres[i].x, spheres[i].y, spheres[i].z};
+        visible[i] = isVisible(center, spheres[i].w) ? 1 : 0;
+        count += visible[i];
+    }
+    return count;
+}
+
+size_t ViewCuller::cullPoints(const std::vector<Vector3>& points, float radius, std::vector<uint8_t>& visible) const {
+    visible.resize(points.size());
+    size_t count = 0;
+    for (size_t i = 0; i < points.size(); i++) {
+        visible[i] = isVisible(points[i], radius) ? 1 : 0;
+        count += visible[i];
+    }
+    return count;
+}
@@ -0,0 +1,46 @@
+#ifndef VIEW_CULLER_H
+#define VIEW_CULLER_H
+
+#include "raylib.h"
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+/**
+ * CPU visibility tests for the current 3D view.
+ *
+ * update() captures the six frustum planes and the camera position from the
+ * active view/projection matrices. A bounding sphere is visible when it
+ * intersects the frustum and the Earth does not hide it completely. The
+ * Earth test is conservative: the sight line from the camera must pass
+ * through a sphere shrunk by the object's radius.
+ */
+class ViewCuller {
+public:
+    ViewCuller();
+
+    // Capture the frustum; call after BeginMode3D each frame. Later tests
+    // are in the frame that was active here.
+    void update();
+
+    bool inFrustum(Vector3 center, float radius) const;
+    bool occludedByEarth(Vector3 center, float radius) const;
+    bool isVisible(Vector3 center, float radius) const {
+        return inFrustum(center, radius) && !occludedByEarth(center, radius);
+    }
+
+    // Batch test of (centre xyz, radius w) spheres; returns the visible count
+    size_t cullSpheres(const std::vector<Vector4>& spheres, std::vector<uint8_t>& visible) const;
+
+    // Batch test of points sharing one radius; returns the visible count
+    size_t cullPoints(const std::vector<Vector3>& points, float radius, std::vector<uint8_t>& visible) const;
+
+    Vector3 getCameraPosition() const { return camera; }
+
+private:
+    Vector4 planes[6];      // Inward normals xyz, offset w (normalised)
+    Vector3 camera;
+    float earthRadius;      // Render units
+};
+
+#endif // VIEW_CULLER_H
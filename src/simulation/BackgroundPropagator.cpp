@@ -0,0 +1,115 @@
+#include "BackgroundPropagator.h"
+#include "OrbitPropagator.h"
+#include "Constants.h"
+
+BackgroundPropagator::BackgroundPropagator(double gravitationalParameter, size_t threadCount)
+    : mu(gravitationalParameter), pool(threadCount), cache(nullptr), generation(0) {}
+
+BackgroundPropagator::~BackgroundPropagator() {
+    cancel();
+    pool.waitIdle();
+}
+
+void BackgroundPropagator::request(
+    const std::vector<OrbitPreset>& presets,
+    const ForceModel& forceModel,
+    const std::vector<GroundStation>& groundStations
+) {
+    // Supersede whatever is still running
+    cancel();
+
+    generation++;
+    currentRun = std::make_shared<Run>(generation, presets.size());
+
+    for (size_t i = 0; i < presets.size(); i++) {
+        std::shared_ptr<Run> run = currentRun;
+        OrbitPreset preset = presets[i];
+
+        pool.submit([this, i, run, preset, forceModel, groundStations]() {
+            if (run->cancelled.load(std::memory_order_relaxed)) return;
+
+            // Each task owns its propagator (integrators are not shared)
+            OrbitPropagator propagator(mu);
+            propagator.setForceModel(forceModel);
+
+            double timestep = preset.period / ORBIT_SAMPLES_PER_PERIOD;
+
+            PropagationResult result;
+            result.satelliteIndex = i;
+            result.generation = run->generation;
+
+            std::string key;
+            CachedTrajectory cached;
+            if (cache) {
+                key = TrajectoryCache::makeKey(preset.initialState, preset.period, timestep, mu,
+                                               forceModel, propagator.getIntegrator().name(),
+                                               groundStations);
+            }
+
+            if (cache && cache->open(key, cached)) {
+                result.trajectory = cached.getTrajectory();
+                result.accessStats = cached.accessStatistics();
+            } else {
+                std::vector<StateVector> trajectory = propagator.propagate(
+                    preset.initialState, preset.period, timestep, &run->cancelled);
+
+                if (run->cancelled.load(std::memory_order_relaxed)) return;
+
+                for (const auto& station : groundStations) {
+                    result.accessStats.push_back(
+                        GroundStationAccess::calculateAccessWindows(trajectory, station, EARTH_RADIUS));
+                }
+
+                // Only the compact form outlives the task
+                result.trajectory = std::make_shared<const CompactTrajectory>(
+                    CompactTrajectory::encode(trajectory));
+                if (cache) cache->store(key, *result.trajectory, result.accessStats);
+            }
+
+            if (run->cancelled.load(std::memory_order_relaxed)) return;
+
+            {
+                std::lock_guard<std::mutex> lock(resultsMutex);
+                results.push_back(std::move(result));
+            }
+            run->completed.fetch_add(1, std::memory_order_relaxed);
+        });
+    }
+}
+
+void BackgroundPropagator::cancel() {
+    if (currentRun) {
+        currentRun->cancelled.store(true);
+    }
+}
+
+std::vector<PropagationResult> BackgroundPropagator::collectResults() {
+    std::vector<PropagationResult> finished;
+    {
+        std::lock_guard<std::mutex> lock(resultsMutex);
+        finished.swap(results);
+    }
+
+    // Drop anything a newer request has superseded
+    std::vector<PropagationResult> current;
+    for (auto& result : finished) {
+        if (result.generation == generation) {
+            current.push_back(std::move(result));
+        }
+    }
+    return current;
+}
+
+size_t BackgroundPropagator::completedCount() const {
+    return currentRun ? currentRun->completed.load(std::memory_order_relaxed) : 0;
+}
+
+size_t BackgroundPropagator::totalCount() const {
+    return currentRun ? currentRun->total : 0;
+}
+
+bool BackgroundPropagator::isBusy() const {
+    return currentRun &&
+           !currentRun->cancelled.load(std::memory_order_relaxed) &&
+           completedCount() < totalCount();
+}
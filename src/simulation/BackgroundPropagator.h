@@ -0,0 +1,80 @@
+#ifndef BACKGROUND_PROPAGATOR_H
+#define BACKGROUND_PROPAGATOR_H
+
+#include "StateVector.h"
+#include "CompactTrajectory.h"
+#include "ForceModel.h"
+#include "OrbitPresets.h"
+#include "GroundStation.h"
+#include "ThreadPool.h"
+#include "TrajectoryCache.h"
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+// One satellite's finished re-propagation
+struct PropagationResult {
+    size_t satelliteIndex;
+    uint64_t generation;                        // Request that produced it
+    std::shared_ptr<const CompactTrajectory> trajectory;
+    std::vector<AccessStatistics> accessStats;  // One entry per ground station
+};
+
+// Re-propagates satellites on a thread pool after a force-model change.
+//
+// Each request() supersedes the previous one: in-flight tasks of the older
+// run are cancelled and their results discarded. Finished satellites are
+// streamed back one at a time through collectResults() so the scene updates
+// progressively instead of waiting for the whole catalog.
+class BackgroundPropagator {
+public:
+    explicit BackgroundPropagator(double mu, size_t threadCount = 0);
+    ~BackgroundPropagator();
+
+    // Start re-propagating all presets with the given force model
+    void request(
+        const std::vector<OrbitPreset>& presets,
+        const ForceModel& forceModel,
+        const std::vector<GroundStation>& groundStations
+    );
+
+    // Look up / store results in this cache (nullptr disables; not owned)
+    void setCache(const TrajectoryCache* trajectoryCache) { cache = trajectoryCache; }
+    
+    // Cancel the current run (results already collected are kept)
+    void cancel();
+
+    // Main thread: take all results finished since the last call
+    std::vector<PropagationResult> collectResults();
+
+    // Progress of the current run
+    size_t completedCount() const;
+    size_t totalCount() const;
+    bool isBusy() const;
+
+private:
+    // Shared between the main thread and the tasks of one request
+    struct Run {
+        uint64_t generation;
+        size_t total;
+        std::atomic<bool> cancelled;
+        std::atomic<size_t> completed;
+
+        Run(uint64_t gen, size_t count)
+            : generation(gen), total(count), cancelled(false), completed(0) {}
+    };
+
+    double mu;
+    ThreadPool pool;
+    const TrajectoryCache* cache;
+
+    uint64_t generation;           // Main-thread only
+    std::shared_ptr<Run> currentRun;
+
+    std::mutex resultsMutex;
+    std::vector<PropagationResult> results;
+};
+
+#endif // BACKGROUND_PROPAGATOR_H
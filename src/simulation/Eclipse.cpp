@@ -20,16 +20,17 @@ EclipseStatus EclipseDetector::checkEclipse(
     double cosAngle = satNorm.dot(sunNorm);
     status.sunAngle = acos(cosAngle) * 180.0 / M_PI;
     
-    // If satellite is on sun side, no eclipse
-    if (cosAngle > 0) {
-        return status;
-    }
-    
     // Calculate angular radius of Earth from satellite
     double earthAngularRadius = asin(earthRadius / satDistance);
     
     // Angle from sun direction to satellite
     double angleFromSun = acos(-cosAngle);  // Negative because satellite is behind Earth
+    status.umbraDepth = (earthAngularRadius - SUN_ANGULAR_RADIUS) - angleFromSun;
+    
+    // If satellite is on sun side, no eclipse
+    if (cosAngle > 0) {
+        return status;
+    }
     
     // Check umbra (full shadow)
     if (angleFromSun < (earthAngularRadius - SUN_ANGULAR_RADIUS)) {
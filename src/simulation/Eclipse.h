@@ -2,14 +2,17 @@
 #define ECLIPSE_H
 
 #include "Vector3D.h"
+#include "Constants.h"
 
 // Eclipse status structure
 struct EclipseStatus {
     bool inUmbra;        // Full shadow
     bool inPenumbra;     // Partial shadow
     double sunAngle;     // Angle between sun and satellite from Earth center (degrees)
+    double umbraDepth;   // Angle inside the umbra cone (radians), negative outside;
+                         // continuous, so shadow crossings can be interpolated
     
-    EclipseStatus() : inUmbra(false), inPenumbra(false), sunAngle(0.0) {}
+    EclipseStatus() : inUmbra(false), inPenumbra(false), sunAngle(0.0), umbraDepth(-M_PI) {}
 };
 
 // Eclipse detection class
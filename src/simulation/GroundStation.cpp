@@ -1,4 +1,5 @@
 #include "GroundStation.h"
+#include "Profiler.h"
 #include <cmath>
 
 #ifndef M_PI
@@ -72,6 +73,7 @@ AccessStatistics GroundStationAccess::calculateAccessWindows(
     const GroundStation& station,
     double earthRadius
 ) {
+    MDV_PROFILE_SCOPE("AccessWindows");
     AccessStatistics stats;
     
     if (orbit.empty()) return stats;
@@ -82,8 +84,8 @@ AccessStatistics GroundStationAccess::calculateAccessWindows(
     double maxElevation = 0.0;
     
     for (size_t i = 0; i < orbit.size(); ++i) {
-        bool visible = isVisible(orbit[i].position, station, earthRadius, orbit[i].time);
         double elevation = calculateElevation(orbit[i].position, station, earthRadius, orbit[i].time);
+        bool visible = elevation >= station.minElevation;
         
         if (visible && !inAccess) {
             // Access window starts
@@ -146,8 +148,7 @@ GroundStation GroundStationPresets::createStation(StationType type) {
                 35.4,    // Goldstone, CA (Deep Space Network)
                 -116.9,
                 0.0,
-                5.0,
-                Color{100, 200, 255, 255}  // Light blue
+                5.0
             );
         
         case ESA_MADRID:
@@ -157,8 +158,7 @@ GroundStation GroundStationPresets::createStation(StationType type) {
                 40.4,    // Cebreros, Spain
                 -4.4,
                 0.0,
-                5.0,
-                Color{255, 200, 100, 255}  // Light orange
+                5.0
             );
         
         case JAXA_USUDA:
@@ -168,8 +168,7 @@ GroundStation GroundStationPresets::createStation(StationType type) {
                 36.1,    // Usuda, Japan
                 138.4,
                 0.0,
-                5.0,
-                Color{255, 100, 100, 255}  // Light red
+                5.0
             );
         
         case NASA_WALLOPS:
@@ -179,8 +178,7 @@ GroundStation GroundStationPresets::createStation(StationType type) {
                 37.9,    // Wallops Island, Virginia
                 -75.5,
                 0.0,
-                5.0,
-                Color{100, 255, 100, 255}  // Light green
+                5.0
             );
         
         case ESA_KOUROU:
@@ -190,8 +188,7 @@ GroundStation GroundStationPresets::createStation(StationType type) {
                 5.2,     // French Guiana
                 -52.8,
                 0.0,
-                5.0,
-                Color{200, 100, 255, 255}  // Light purple
+                5.0
             );
         
         default:
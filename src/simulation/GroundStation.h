@@ -4,7 +4,6 @@
 #include "Vector3D.h"
 #include "StateVector.h"
 #include "GroundTrack.h"
-#include "raylib.h"
 #include <string>
 #include <vector>
 
@@ -14,19 +13,18 @@ struct GroundStation {
     std::string code;        // e.g., "JPL", "MAD", "USD"
     GeoCoordinate location;  // Latitude, longitude, altitude
     double minElevation;     // Minimum elevation angle (degrees)
-    Color color;
     bool visible;
     
     GroundStation()
         : name(""), code(""), location(), minElevation(5.0), 
-          color(WHITE), visible(true) {}
+          visible(true) {}
     
     GroundStation(const std::string& n, const std::string& c, 
                   double lat, double lon, double alt = 0.0,
-                  double minElev = 5.0, Color col = WHITE)
+                  double minElev = 5.0)
         : name(n), code(c), 
           location(lat, lon, alt),
-          minElevation(minElev), color(col), visible(true) {}
+          minElevation(minElev), visible(true) {}
 };
 
 // Access window - when satellite can communicate with station
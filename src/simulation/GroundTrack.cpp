@@ -1,4 +1,5 @@
 #include "GroundTrack.h"
+#include "Profiler.h"
 #include <cmath>
 
 GeoCoordinate GroundTrack::ECIToLatLon(const Vector3D& eciPosition, double timeSeconds) {
@@ -53,6 +54,7 @@ std::vector<GeoCoordinate> GroundTrack::calculateGroundTrack(
     const std::vector<StateVector>& orbit,
     int samplesPerOrbit
 ) {
+    MDV_PROFILE_SCOPE("GroundTrack");
     std::vector<GeoCoordinate> groundTrack;
     
     if (orbit.empty()) return groundTrack;
@@ -1,5 +1,7 @@
 #include "Integrator.h"
 #include "Constants.h"
+#include "OrbitalElements.h"
+#include <algorithm>
 #include <cmath>
 
 // ============================================================================
@@ -53,6 +55,170 @@ Vector3D Integrator::computeAcceleration(
     return totalAccel;
 }
 
+void Integrator::computeAccelerationBatch(
+    const double* x, const double* y, const double* z,
+    double* ax, double* ay, double* az,
+    size_t count,
+    double mu,
+    const ForceModel& forces
+) const {
+    double j2Factor = 1.5 * EARTH_J2 * mu * EARTH_RADIUS * EARTH_RADIUS;
+    double pointMass = forces.pointMass ? 1.0 : 0.0;
+    double j2 = forces.j2Perturbation ? 1.0 : 0.0;
+    
+    // Same terms as computePointMassGravity + computeJ2Perturbation,
+    // with the switches folded into factors so the loop has no branches
+    for (size_t i = 0; i < count; i++) {
+        double r2 = x[i] * x[i] + y[i] * y[i] + z[i] * z[i];
+        double r = std::sqrt(r2);
+        double inverseR3 = 1.0 / (r2 * r);
+        double z2OverR2 = z[i] * z[i] / r2;
+        
+        double central = -mu * inverseR3 * pointMass;
+        double factor = j2 * j2Factor * inverseR3 / r2;
+        double equatorial = central + factor * (5.0 * z2OverR2 - 1.0);
+        double polar = central + factor * (5.0 * z2OverR2 - 3.0);
+        
+        ax[i] = x[i] * equatorial;
+        ay[i] = y[i] * equatorial;
+        az[i] = z[i] * polar;
+    }
+}
+
+std::vector<StateVector> Integrator::integrate(
+    const StateVector& initial,
+    double timestep,
+    size_t steps,
+    double mu,
+    const ForceModel& forces,
+    const std::atomic<bool>* cancel
+) const {
+    std::vector<StateVector> trajectory;
+    trajectory.reserve(steps + 1);
+    trajectory.push_back(initial);
+    
+    StateVector current = initial;
+    for (size_t i = 0; i < steps; ++i) {
+        if (cancel && cancel->load(std::memory_order_relaxed)) break;
+        
+        current = step(current, timestep, mu, forces);
+        trajectory.push_back(current);
+    }
+    
+    return trajectory;
+}
+
+// ============================================================================
+// VARIATIONAL EQUATIONS
+// ============================================================================
+
+void Integrator::addPointMassGradient(const Vector3D& position, double mu, double gradient[9]) const {
+    // mu / r^5 * (3 r r^T - r^2 I)
+    double p[3] = {position.x, position.y, position.z};
+    double r2 = position.dot(position);
+    double r = std::sqrt(r2);
+    double scale = mu / (r2 * r2 * r);
+    
+    for (int i = 0; i < 3; i++) {
+        for (int j = 0; j < 3; j++) {
+            gradient[i * 3 + j] += scale * (3.0 * p[i] * p[j] - (i == j ? r2 : 0.0));
+        }
+    }
+}
+
+void Integrator::addJ2Gradient(const Vector3D& position, double mu, double gradient[9]) const {
+    // a_i = k x_i (5u - c_i) / r^5 with u = z^2 / r^2 and c = (1, 1, 3)
+    double p[3] = {position.x, position.y, position.z};
+    const double c[3] = {1.0, 1.0, 3.0};
+    double r2 = position.dot(position);
+    double r = std::sqrt(r2);
+    double u = p[2] * p[2] / r2;
+    double k = 1.5 * EARTH_J2 * mu * EARTH_RADIUS * EARTH_RADIUS / (r2 * r2 * r);
+    
+    for (int i = 0; i < 3; i++) {
+        double shape = 5.0 * u - c[i];
+        for (int j = 0; j < 3; j++) {
+            double value = -(5.0 * shape + 10.0 * u) * p[i] * p[j] / r2;
+            if (i == j) value += shape;
+            if (j == 2) value += 10.0 * p[i] * p[2] / r2;
+            gradient[i * 3 + j] += k * value;
+        }
+    }
+}
+
+void Integrator::computeAccelerationGradient(
+    const Vector3D& position,
+    double mu,
+    const ForceModel& forces,
+    double gradient[9]
+) const {
+    for (int i = 0; i < 9; i++) gradient[i] = 0.0;
+    
+    if (forces.pointMass) {
+        addPointMassGradient(position, mu, gradient);
+    }
+    
+    if (forces.j2Perturbation) {
+        addJ2Gradient(position, mu, gradient);
+    }
+}
+
+void Integrator::variationalDerivative(const double* y, double* dy, double mu, const ForceModel& forces) const {
+    Vector3D position(y[0], y[1], y[2]);
+    Vector3D accel = computeAcceleration(position, mu, forces);
+    double g[9];
+    computeAccelerationGradient(position, mu, forces, g);
+    
+    dy[0] = y[3];
+    dy[1] = y[4];
+    dy[2] = y[5];
+    dy[3] = accel.x;
+    dy[4] = accel.y;
+    dy[5] = accel.z;
+    
+    // d/dt [Phi_r; Phi_v] = [Phi_v; G Phi_r], each block 3x6 and contiguous
+    const double* phiR = y + 6;
+    const double* phiV = y + 24;
+    for (int n = 0; n < 18; n++) {
+        dy[6 + n] = phiV[n];
+    }
+    for (int i = 0; i < 3; i++) {
+        for (int j = 0; j < 6; j++) {
+            dy[24 + i * 6 + j] = g[i * 3] * phiR[j] + g[i * 3 + 1] * phiR[6 + j] + g[i * 3 + 2] * phiR[12 + j];
+        }
+    }
+}
+
+StateVector Integrator::stepVariational(
+    const StateVector& state,
+    StateTransitionMatrix& phi,
+    double h,
+    double mu,
+    const ForceModel& forces
+) const {
+    const int n = VARIATIONAL_SIZE;
+    double y[n], k1[n], k2[n], k3[n], k4[n], stage[n];
+    
+    y[0] = state.position.x; y[1] = state.position.y; y[2] = state.position.z;
+    y[3] = state.velocity.x; y[4] = state.velocity.y; y[5] = state.velocity.z;
+    for (int i = 0; i < 36; i++) y[6 + i] = phi.m[i];
+    
+    variationalDerivative(y, k1, mu, forces);
+    for (int i = 0; i < n; i++) stage[i] = y[i] + 0.5 * h * k1[i];
+    variationalDerivative(stage, k2, mu, forces);
+    for (int i = 0; i < n; i++) stage[i] = y[i] + 0.5 * h * k2[i];
+    variationalDerivative(stage, k3, mu, forces);
+    for (int i = 0; i < n; i++) stage[i] = y[i] + h * k3[i];
+    variationalDerivative(stage, k4, mu, forces);
+    
+    for (int i = 0; i < n; i++) {
+        y[i] += h / 6.0 * (k1[i] + 2.0 * k2[i] + 2.0 * k3[i] + k4[i]);
+    }
+    
+    for (int i = 0; i < 36; i++) phi.m[i] = y[6 + i];
+    return StateVector(Vector3D(y[0], y[1], y[2]), Vector3D(y[3], y[4], y[5]), state.time + h);
+}
+
 // ============================================================================
 // EULER INTEGRATOR
 // ============================================================================
@@ -114,4 +280,560 @@ StateVector RK4Integrator::step(
         (k1_a + k2_a*2.0 + k3_a*2.0 + k4_a) * (h/6.0);
     
     return StateVector(newPos, newVel, state.time + h);
-}
\ No newline at end of file
+}
+
+void RK4Integrator::stepBatch(
+    StateBatch& b,
+    double h,
+    double mu,
+    const ForceModel& forces
+) const {
+    // The stage arrays hold WIDTH lanes, so never read or write past them
+    const size_t W = StateBatch::WIDTH;
+    const size_t n = std::min(b.count, W);
+    if (n == 0) return;
+    
+    // Stage positions and accelerations; velocities are reconstructed from
+    // the accelerations, so each stage needs only its position
+    double px[W], py[W], pz[W];
+    double a1x[W], a1y[W], a1z[W], a2x[W], a2y[W], a2z[W];
+    double a3x[W], a3y[W], a3z[W], a4x[W], a4y[W], a4z[W];
+    
+    computeAccelerationBatch(b.x, b.y, b.z, a1x, a1y, a1z, n, mu, forces);
+    
+    // k2: r + h/2 v1
+    for (size_t i = 0; i < n; i++) {
+        px[i] = b.x[i] + 0.5 * h * b.vx[i];
+        py[i] = b.y[i] + 0.5 * h * b.vy[i];
+        pz[i] = b.z[i] + 0.5 * h * b.vz[i];
+    }
+    computeAccelerationBatch(px, py, pz, a2x, a2y, a2z, n, mu, forces);
+    
+    // k3: r + h/2 v2, v2 = v + h/2 a1
+    for (size_t i = 0; i < n; i++) {
+        px[i] = b.x[i] + 0.5 * h * (b.vx[i] + 0.5 * h * a1x[i]);
+        py[i] = b.y[i] + 0.5 * h * (b.vy[i] + 0.5 * h * a1y[i]);
+        pz[i] = b.z[i] + 0.5 * h * (b.vz[i] + 0.5 * h * a1z[i]);
+    }
+    computeAccelerationBatch(px, py, pz, a3x, a3y, a3z, n, mu, forces);
+    
+    // k4: r + h v3, v3 = v + h/2 a2
+    for (size_t i = 0; i < n; i++) {
+        px[i] = b.x[i] + h * (b.vx[i] + 0.5 * h * a2x[i]);
+        py[i] = b.y[i] + h * (b.vy[i] + 0.5 * h * a2y[i]);
+        pz[i] = b.z[i] + h * (b.vz[i] + 0.5 * h * a2z[i]);
+    }
+    computeAccelerationBatch(px, py, pz, a4x, a4y, a4z, n, mu, forces);
+    
+    // Position weights the stage velocities (v, v2, v3, v4) 1:2:2:1
+    double h6 = h / 6.0;
+    for (size_t i = 0; i < n; i++) {
+        b.x[i] += h6 * (6.0 * b.vx[i] + h * (a1x[i] + a2x[i] + a3x[i]));
+        b.y[i] += h6 * (6.0 * b.vy[i] + h * (a1y[i] + a2y[i] + a3y[i]));
+        b.z[i] += h6 * (6.0 * b.vz[i] + h * (a1z[i] + a2z[i] + a3z[i]));
+        b.vx[i] += h6 * (a1x[i] + 2.0 * a2x[i] + 2.0 * a3x[i] + a4x[i]);
+        b.vy[i] += h6 * (a1y[i] + 2.0 * a2y[i] + 2.0 * a3y[i] + a4y[i]);
+        b.vz[i] += h6 * (a1z[i] + 2.0 * a2z[i] + 2.0 * a3z[i] + a4z[i]);
+    }
+}
+
+// ============================================================================
+// RUNGE-KUTTA-NYSTROM INTEGRATORS
+// ============================================================================
+
+StateVector RKN4Integrator::step(
+    const StateVector& state,
+    double h,
+    double mu,
+    const ForceModel& forces
+) const {
+    // Stages on positions only; velocities follow from the quadrature
+    Vector3D k1 = computeAcceleration(state.position, mu, forces);
+    Vector3D k2 = computeAcceleration(
+        state.position + state.velocity * (h/2.0) + k1 * (h*h/8.0), mu, forces);
+    Vector3D k3 = computeAcceleration(
+        state.position + state.velocity * h + k2 * (h*h/2.0), mu, forces);
+    
+    Vector3D newPos = state.position + state.velocity * h + (k1 + k2*2.0) * (h*h/6.0);
+    Vector3D newVel = state.velocity + (k1 + k2*4.0 + k3) * (h/6.0);
+    
+    return StateVector(newPos, newVel, state.time + h);
+}
+
+StormerExtrapolationIntegrator::StormerExtrapolationIntegrator(int levels)
+    : levels(std::max(1, std::min(levels, MAX_LEVELS))) {}
+
+const char* StormerExtrapolationIntegrator::name() const {
+    static const char* names[MAX_LEVELS] = {
+        "GBS2", "GBS4", "GBS6", "GBS8", "GBS10", "GBS12", "GBS14", "GBS16"};
+    return names[levels - 1];
+}
+
+StateVector StormerExtrapolationIntegrator::stormer(
+    const StateVector& state,
+    const Vector3D& initialAcceleration,
+    double h,
+    int substeps,
+    double mu,
+    const ForceModel& forces
+) const {
+    double dt = h / substeps;
+    
+    // Position increments: d_0 = dt*(v + dt/2*a_0), d_k = d_{k-1} + dt^2*a_k
+    Vector3D increment = (state.velocity + initialAcceleration * (dt/2.0)) * dt;
+    Vector3D position = state.position + increment;
+    for (int k = 1; k < substeps; k++) {
+        increment += computeAcceleration(position, mu, forces) * (dt*dt);
+        position += increment;
+    }
+    
+    Vector3D velocity = increment / dt + computeAcceleration(position, mu, forces) * (dt/2.0);
+    return StateVector(position, velocity, state.time + h);
+}
+
+StateVector StormerExtrapolationIntegrator::step(
+    const StateVector& state,
+    double h,
+    double mu,
+    const ForceModel& forces
+) const {
+    Vector3D a0 = computeAcceleration(state.position, mu, forces);
+    
+    // Aitken-Neville tableau in (h/n)^2 towards zero substep
+    Vector3D position[MAX_LEVELS];
+    Vector3D velocity[MAX_LEVELS];
+    for (int i = 0; i < levels; i++) {
+        int n = 2 * (i + 1);
+        StateVector estimate = stormer(state, a0, h, n, mu, forces);
+        position[i] = estimate.position;
+        velocity[i] = estimate.velocity;
+        
+        for (int j = i - 1; j >= 0; j--) {
+            double ratio = static_cast<double>(n) / (2 * (j + 1));
+            double factor = 1.0 / (ratio * ratio - 1.0);
+            position[j] = position[j + 1] + (position[j + 1] - position[j]) * factor;
+            velocity[j] = velocity[j + 1] + (velocity[j + 1] - velocity[j]) * factor;
+        }
+    }
+    
+    return StateVector(position[0], velocity[0], state.time + h);
+}
+
+// ============================================================================
+// ADAMS-BASHFORTH-MOULTON INTEGRATOR
+// ============================================================================
+
+AdamsBashforthMoultonIntegrator::AdamsBashforthMoultonIntegrator() {
+    // Nodes in units of the step, relative to t_n
+    double bashforthNodes[ORDER];
+    double moultonNodes[ORDER];
+    for (int j = 0; j < ORDER; j++) {
+        bashforthNodes[j] = -j;
+        moultonNodes[j] = 1 - j;
+    }
+    quadratureWeights(bashforthNodes, predictor);
+    quadratureWeights(moultonNodes, corrector);
+}
+
+void AdamsBashforthMoultonIntegrator::quadratureWeights(const double* nodes, double* weights) {
+    for (int j = 0; j < ORDER; j++) {
+        // Coefficients of L_j(s) = prod_{m != j} (s - t_m) / (t_j - t_m), lowest power first
+        double poly[ORDER] = {1.0};
+        int degree = 0;
+        for (int m = 0; m < ORDER; m++) {
+            if (m == j) continue;
+            double scale = 1.0 / (nodes[j] - nodes[m]);
+            for (int p = degree + 1; p > 0; p--) {
+                poly[p] = (poly[p - 1] - nodes[m] * poly[p]) * scale;
+            }
+            poly[0] *= -nodes[m] * scale;
+            degree++;
+        }
+        
+        weights[j] = 0.0;
+        for (int p = 0; p <= degree; p++) {
+            weights[j] += poly[p] / (p + 1);
+        }
+    }
+}
+
+StateVector AdamsBashforthMoultonIntegrator::step(
+    const StateVector& state,
+    double h,
+    double mu,
+    const ForceModel& forces
+) const {
+    return starter.step(state, h, mu, forces);
+}
+
+std::vector<StateVector> AdamsBashforthMoultonIntegrator::integrate(
+    const StateVector& initial,
+    double h,
+    size_t steps,
+    double mu,
+    const ForceModel& forces,
+    const std::atomic<bool>* cancel
+) const {
+    // Start-up fills the history with ORDER states
+    size_t startSteps = std::min(steps, static_cast<size_t>(ORDER - 1));
+    std::vector<StateVector> trajectory = starter.integrate(initial, h, startSteps, mu, forces, cancel);
+    if (trajectory.size() < startSteps + 1 || steps == startSteps) return trajectory;
+    trajectory.reserve(steps + 1);
+    
+    // Derivative history (v, a), newest first
+    Vector3D velocities[ORDER];
+    Vector3D accelerations[ORDER];
+    for (int j = 0; j < ORDER; j++) {
+        const StateVector& s = trajectory[ORDER - 1 - j];
+        velocities[j] = s.velocity;
+        accelerations[j] = computeAcceleration(s.position, mu, forces);
+    }
+    
+    StateVector current = trajectory.back();
+    for (size_t i = startSteps; i < steps; ++i) {
+        if (cancel && cancel->load(std::memory_order_relaxed)) break;
+        
+        // Predict
+        Vector3D dr(0, 0, 0), dv(0, 0, 0);
+        for (int j = 0; j < ORDER; j++) {
+            dr += velocities[j] * predictor[j];
+            dv += accelerations[j] * predictor[j];
+        }
+        Vector3D predictedVel = current.velocity + dv * h;
+        Vector3D predictedAcc = computeAcceleration(current.position + dr * h, mu, forces);
+        
+        // Correct with the predicted derivative in place of f_n+1
+        dr = predictedVel * corrector[0];
+        dv = predictedAcc * corrector[0];
+        for (int j = 1; j < ORDER; j++) {
+            dr += velocities[j - 1] * corrector[j];
+            dv += accelerations[j - 1] * corrector[j];
+        }
+        current = StateVector(current.position + dr * h, current.velocity + dv * h, current.time + h);
+        trajectory.push_back(current);
+        
+        // Evaluate at the corrected state and shift the history
+        for (int j = ORDER - 1; j > 0; j--) {
+            velocities[j] = velocities[j - 1];
+            accelerations[j] = accelerations[j - 1];
+        }
+        velocities[0] = current.velocity;
+        accelerations[0] = computeAcceleration(current.position, mu, forces);
+    }
+    
+    return trajectory;
+}
+
+// ============================================================================
+// ENCKE INTEGRATOR
+// ============================================================================
+
+EnckeIntegrator::EnckeIntegrator(double rectifyRatio)
+    : rectifyRatio(rectifyRatio) {}
+
+Vector3D EnckeIntegrator::deviationAcceleration(
+    const Vector3D& rho,
+    const Vector3D& delta,
+    double mu,
+    const ForceModel& perturbations
+) const {
+    Vector3D r = rho + delta;
+    
+    // Battin's f(q) = (rho/r)^3 - 1 without the cancellation of the direct form
+    double q = delta.dot(delta - r * 2.0) / r.dot(r);
+    double onePlusQ = 1.0 + q;
+    double f = q * (3.0 + 3.0 * q + q * q) / (1.0 + onePlusQ * std::sqrt(onePlusQ));
+    
+    double rhoMag = rho.magnitude();
+    double scale = -mu / (rhoMag * rhoMag * rhoMag);
+    return (r * f + delta) * scale + computeAcceleration(r, mu, perturbations);
+}
+
+void EnckeIntegrator::deviationStep(
+    const StateVector& reference,
+    const StateVector& rho0,
+    double elapsed,
+    double h,
+    double mu,
+    const ForceModel& perturbations,
+    Vector3D& delta,
+    Vector3D& deltaVel,
+    StateVector& rho1
+) const {
+    StateVector rhoMid = OrbitalElements::propagateTwoBody(reference, elapsed + 0.5 * h, mu);
+    rho1 = OrbitalElements::propagateTwoBody(reference, elapsed + h, mu);
+    
+    // RK4 on (delta, delta')
+    Vector3D k1v = deviationAcceleration(rho0.position, delta, mu, perturbations);
+    Vector3D k1r = deltaVel;
+    
+    Vector3D k2v = deviationAcceleration(rhoMid.position, delta + k1r * (h * 0.5), mu, perturbations);
+    Vector3D k2r = deltaVel + k1v * (h * 0.5);
+    
+    Vector3D k3v = deviationAcceleration(rhoMid.position, delta + k2r * (h * 0.5), mu, perturbations);
+    Vector3D k3r = deltaVel + k2v * (h * 0.5);
+    
+    Vector3D k4v = deviationAcceleration(rho1.position, delta + k3r * h, mu, perturbations);
+    Vector3D k4r = deltaVel + k3v * h;
+    
+    delta += (k1r + k2r * 2.0 + k3r * 2.0 + k4r) * (h / 6.0);
+    deltaVel += (k1v + k2v * 2.0 + k3v * 2.0 + k4v) * (h / 6.0);
+}
+
+StateVector EnckeIntegrator::step(
+    const StateVector& state,
+    double h,
+    double mu,
+    const ForceModel& forces
+) const {
+    ForceModel perturbations = forces;
+    perturbations.pointMass = false;
+    
+    // A single step starts from a fresh rectification at `state`
+    Vector3D delta(0, 0, 0);
+    Vector3D deltaVel(0, 0, 0);
+    StateVector rho1;
+    deviationStep(state, state, 0.0, h, mu, perturbations, delta, deltaVel, rho1);
+    
+    return StateVector(rho1.position + delta, rho1.velocity + deltaVel, state.time + h);
+}
+
+std::vector<StateVector> EnckeIntegrator::integrate(
+    const StateVector& initial,
+    double h,
+    size_t steps,
+    double mu,
+    const ForceModel& forces,
+    const std::atomic<bool>* cancel
+) const {
+    std::vector<StateVector> trajectory;
+    trajectory.reserve(steps + 1);
+    trajectory.push_back(initial);
+    
+    // Everything except the central term acts on the deviation
+    ForceModel perturbations = forces;
+    perturbations.pointMass = false;
+    
+    StateVector reference = initial;   // Osculating state at the last rectification
+    double elapsed = 0.0;              // Time since then
+    Vector3D delta(0, 0, 0);
+    Vector3D deltaVel(0, 0, 0);
+    StateVector rho0 = reference;
+    
+    for (size_t i = 0; i < steps; ++i) {
+        if (cancel && cancel->load(std::memory_order_relaxed)) break;
+        
+        StateVector rho1;
+        deviationStep(reference, rho0, elapsed, h, mu, perturbations, delta, deltaVel, rho1);
+        elapsed += h;
+        
+        StateVector current(rho1.position + delta, rho1.velocity + deltaVel, initial.time + (i + 1) * h);
+        trajectory.push_back(current);
+        
+        if (delta.magnitude() > rectifyRatio * rho1.position.magnitude()) {
+            reference = current;
+            elapsed = 0.0;
+            delta = Vector3D(0, 0, 0);
+            deltaVel = Vector3D(0, 0, 0);
+            rho0 = reference;
+        } else {
+            rho0 = rho1;
+        }
+    }
+    
+    return trajectory;
+}
+
+// ============================================================================
+// SUNDMAN INTEGRATOR
+// ============================================================================
+
+double SundmanIntegrator::regularizedStep(const StateVector& initial, double h, double mu) {
+    // Mean of 1/r over time is 1/a on an ellipse; unbound orbits use r0
+    double r0 = initial.position.magnitude();
+    double inverseA = 2.0 / r0 - initial.velocity.dot(initial.velocity) / mu;
+    return (inverseA > 0.0) ? h * inverseA : h / r0;
+}
+
+StateVector SundmanIntegrator::advance(
+    const StateVector& current,
+    const Vector3D& accel,
+    double ds,
+    double mu,
+    const ForceModel& forces
+) const {
+    // RK4 on d(r, v, t)/ds = r * (v, a, 1)
+    const Vector3D& p = current.position;
+    const Vector3D& v = current.velocity;
+    
+    double w1 = p.magnitude();
+    Vector3D k1r = v * w1;
+    Vector3D k1v = accel * w1;
+    
+    Vector3D p2 = p + k1r * (ds * 0.5);
+    Vector3D v2 = v + k1v * (ds * 0.5);
+    double w2 = p2.magnitude();
+    Vector3D k2r = v2 * w2;
+    Vector3D k2v = computeAcceleration(p2, mu, forces) * w2;
+    
+    Vector3D p3 = p + k2r * (ds * 0.5);
+    Vector3D v3 = v + k2v * (ds * 0.5);
+    double w3 = p3.magnitude();
+    Vector3D k3r = v3 * w3;
+    Vector3D k3v = computeAcceleration(p3, mu, forces) * w3;
+    
+    Vector3D p4 = p + k3r * ds;
+    Vector3D v4 = v + k3v * ds;
+    double w4 = p4.magnitude();
+    Vector3D k4r = v4 * w4;
+    Vector3D k4v = computeAcceleration(p4, mu, forces) * w4;
+    
+    return StateVector(
+        p + (k1r + k2r * 2.0 + k3r * 2.0 + k4r) * (ds / 6.0),
+        v + (k1v + k2v * 2.0 + k3v * 2.0 + k4v) * (ds / 6.0),
+        current.time + (w1 + 2.0 * w2 + 2.0 * w3 + w4) * (ds / 6.0)
+    );
+}
+
+StateVector SundmanIntegrator::step(
+    const StateVector& state,
+    double h,
+    double mu,
+    const ForceModel& forces
+) const {
+    double ds = regularizedStep(state, h, mu);
+    double t = state.time + h;
+    
+    // Regularized steps until one passes t, then interpolate inside it
+    StateVector current = state;
+    Vector3D accel = computeAcceleration(current.position, mu, forces);
+    for (;;) {
+        StateVector next = advance(current, accel, ds, mu, forces);
+        Vector3D nextAccel = computeAcceleration(next.position, mu, forces);
+        if (t <= next.time) {
+            return interpolate(current, accel, next, nextAccel, t);
+        }
+        current = next;
+        accel = nextAccel;
+    }
+}
+
+std::vector<StateVector> SundmanIntegrator::integrate(
+    const StateVector& initial,
+    double h,
+    size_t steps,
+    double mu,
+    const ForceModel& forces,
+    const std::atomic<bool>* cancel
+) const {
+    std::vector<StateVector> trajectory;
+    trajectory.reserve(steps + 1);
+    trajectory.push_back(initial);
+    if (steps == 0) return trajectory;
+    
+    double ds = regularizedStep(initial, h, mu);
+    
+    StateVector current = initial;
+    Vector3D accel = computeAcceleration(current.position, mu, forces);
+    size_t emitted = 0;
+    
+    while (emitted < steps) {
+        if (cancel && cancel->load(std::memory_order_relaxed)) break;
+        
+        StateVector next = advance(current, accel, ds, mu, forces);
+        Vector3D nextAccel = computeAcceleration(next.position, mu, forces);
+        
+        // Emit every requested time inside this regularized step
+        while (emitted < steps) {
+            double t = initial.time + (emitted + 1) * h;
+            if (t > next.time) break;
+            trajectory.push_back(interpolate(current, accel, next, nextAccel, t));
+            emitted++;
+        }
+        
+        current = next;
+        accel = nextAccel;
+    }
+    
+    return trajectory;
+}
+
+StateVector SundmanIntegrator::interpolate(
+    const StateVector& a, const Vector3D& accelA,
+    const StateVector& b, const Vector3D& accelB,
+    double t
+) {
+    double dt = b.time - a.time;
+    double u = (t - a.time) / dt;
+    double u2 = u * u, u3 = u2 * u, u4 = u3 * u, u5 = u4 * u;
+    
+    // Quintic Hermite basis matching value, first and second derivative at both ends
+    double h0 = 1.0 - 10.0 * u3 + 15.0 * u4 - 6.0 * u5;
+    double h1 = u - 6.0 * u3 + 8.0 * u4 - 3.0 * u5;
+    double h2 = 0.5 * (u2 - 3.0 * u3 + 3.0 * u4 - u5);
+    double h3 = 0.5 * (u3 - 2.0 * u4 + u5);
+    double h4 = -4.0 * u3 + 7.0 * u4 - 3.0 * u5;
+    double h5 = 1.0 - h0;
+    
+    double d0 = -30.0 * u2 + 60.0 * u3 - 30.0 * u4;
+    double d1 = 1.0 - 18.0 * u2 + 32.0 * u3 - 15.0 * u4;
+    double d2 = u - 4.5 * u2 + 6.0 * u3 - 2.5 * u4;
+    double d3 = 1.5 * u2 - 4.0 * u3 + 2.5 * u4;
+    double d4 = -12.0 * u2 + 28.0 * u3 - 15.0 * u4;
+    double d5 = -d0;
+    
+    double dt2 = dt * dt;
+    Vector3D position = a.position * h0 + a.velocity * (h1 * dt) + accelA * (h2 * dt2)
+                      + accelB * (h3 * dt2) + b.velocity * (h4 * dt) + b.position * h5;
+    Vector3D velocity = (a.position * d0 + b.position * d5) / dt + a.velocity * d1 + b.velocity * d4
+                      + (accelA * d2 + accelB * d3) * dt;
+    
+    return StateVector(position, velocity, t);
+}
+
+// ============================================================================
+// SYMPLECTIC INTEGRATORS
+// ============================================================================
+
+StateVector SymplecticIntegrator::step(
+    const StateVector& state,
+    double h,
+    double mu,
+    const ForceModel& forces
+) const {
+    Vector3D position = state.position;
+    Vector3D velocity = state.velocity;
+    
+    // Drift half, kick with the force at the midpoint, drift half
+    for (double w : weights) {
+        double substep = w * h;
+        position += velocity * (substep / 2.0);
+        velocity += computeAcceleration(position, mu, forces) * substep;
+        position += velocity * (substep / 2.0);
+    }
+    
+    return StateVector(position, velocity, state.time + h);
+}
+
+std::vector<double> SymplecticIntegrator::yoshidaWeights(const std::vector<double>& outer) {
+    double sum = 0.0;
+    for (double w : outer) sum += w;
+    
+    std::vector<double> weights(outer.rbegin(), outer.rend());
+    weights.push_back(1.0 - 2.0 * sum);
+    weights.insert(weights.end(), outer.begin(), outer.end());
+    return weights;
+}
+
+Yoshida4Integrator::Yoshida4Integrator()
+    : SymplecticIntegrator(yoshidaWeights({1.0 / (2.0 - std::cbrt(2.0))})) {}
+
+// Yoshida (1990), Phys. Lett. A 150, table 1 (w_1 ... w_m)
+Yoshida6Integrator::Yoshida6Integrator()
+    : SymplecticIntegrator(yoshidaWeights({
+          -0.117767998417887e1, 0.235573213359357e0, 0.784513610477560e0})) {}
+
+Yoshida8Integrator::Yoshida8Integrator()
+    : SymplecticIntegrator(yoshidaWeights({
+          0.102799849391985e0, -0.196061023297549e1, 0.193813913762276e1, -0.158240635368243e0,
+          -0.144485223686048e1, 0.253693336566229e0, 0.914844246229740e0})) {}
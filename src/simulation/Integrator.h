@@ -3,6 +3,19 @@
 
 #include "StateVector.h"
 #include "ForceModel.h"
+#include "StateTransitionMatrix.h"
+#include <atomic>
+#include <cstddef>
+#include <vector>
+
+// Structure-of-arrays block of states stepped together (ensembles)
+struct StateBatch {
+    static constexpr size_t WIDTH = 64;
+    
+    size_t count = 0;
+    double x[WIDTH], y[WIDTH], z[WIDTH];        // km
+    double vx[WIDTH], vy[WIDTH], vz[WIDTH];     // km/s
+};
 
 class Integrator {
 public:
@@ -16,6 +29,36 @@ public:
         const ForceModel& forces
     ) const = 0;
     
+    // Fixed-step trajectory of steps + 1 states starting with `initial`
+    // (stops early and returns the partial trajectory if cancel is set).
+    // The default repeats step(); multistep methods override it to carry
+    // their history between steps.
+    virtual std::vector<StateVector> integrate(
+        const StateVector& initial,
+        double timestep,
+        size_t steps,
+        double mu,
+        const ForceModel& forces,
+        const std::atomic<bool>* cancel = nullptr
+    ) const;
+    
+    // One step together with the state transition matrix: phi holds
+    // Phi(t, t0) on entry and Phi(t + timestep, t0) on return. The default
+    // integrates the 42-dimensional variational system with RK4.
+    virtual StateVector stepVariational(
+        const StateVector& current,
+        StateTransitionMatrix& phi,
+        double timestep,
+        double mu,
+        const ForceModel& forces
+    ) const;
+    
+    // Short identifier (used in cache keys and reports)
+    virtual const char* name() const = 0;
+    
+    // Acceleration evaluations per step (cost measure for comparisons)
+    virtual int forceEvaluationsPerStep() const = 0;
+    
 protected:
     // Compute total acceleration from all forces
     Vector3D computeAcceleration(
@@ -27,6 +70,31 @@ protected:
     // Individual force calculations
     Vector3D computePointMassGravity(const Vector3D& position, double mu) const;
     Vector3D computeJ2Perturbation(const Vector3D& position, double mu) const;
+    
+    // computeAcceleration for count positions in separate x/y/z arrays
+    void computeAccelerationBatch(
+        const double* x, const double* y, const double* z,
+        double* ax, double* ay, double* az,
+        size_t count,
+        double mu,
+        const ForceModel& forces
+    ) const;
+    
+    // Jacobian da/dr (3x3, row-major) of the total acceleration
+    void computeAccelerationGradient(
+        const Vector3D& position,
+        double mu,
+        const ForceModel& forces,
+        double gradient[9]
+    ) const;
+    
+    // Individual Jacobians, added to gradient
+    void addPointMassGradient(const Vector3D& position, double mu, double gradient[9]) const;
+    void addJ2Gradient(const Vector3D& position, double mu, double gradient[9]) const;
+    
+    // Variational system y = (r, v, Phi rows 0-5), 42 values
+    static constexpr int VARIATIONAL_SIZE = 42;
+    void variationalDerivative(const double* y, double* dy, double mu, const ForceModel& forces) const;
 };
 
 // Euler integrator (simple, first-order)
@@ -38,6 +106,9 @@ public:
         double mu,
         const ForceModel& forces
     ) const override;
+    
+    const char* name() const override { return "Euler"; }
+    int forceEvaluationsPerStep() const override { return 1; }
 };
 
 // Runge-Kutta 4th order (accurate, fourth-order)
@@ -49,6 +120,265 @@ public:
         double mu,
         const ForceModel& forces
     ) const override;
+    
+    // Advance every state in the batch by one step; the stage loops run
+    // across the batch so they vectorize
+    void stepBatch(
+        StateBatch& batch,
+        double timestep,
+        double mu,
+        const ForceModel& forces
+    ) const;
+    
+    const char* name() const override { return "RK4"; }
+    int forceEvaluationsPerStep() const override { return 4; }
+};
+
+// Runge-Kutta-Nystrom 4th order for y'' = f(y). With velocity-independent
+// forces the two midpoint stages coincide, leaving three evaluations.
+class RKN4Integrator : public Integrator {
+public:
+    StateVector step(
+        const StateVector& current,
+        double timestep,
+        double mu,
+        const ForceModel& forces
+    ) const override;
+    
+    const char* name() const override { return "RKN4"; }
+    int forceEvaluationsPerStep() const override { return 3; }
+};
+
+// Gragg-Bulirsch-Stoer extrapolation of Stormer's rule (the Nystrom form of
+// the modified midpoint method). Its error expands in even powers of the
+// substep, so `levels` substep counts 2, 4, ..., 2*levels extrapolate to
+// order 2*levels: high-order reference trajectories from large steps.
+class StormerExtrapolationIntegrator : public Integrator {
+public:
+    static constexpr int MAX_LEVELS = 8;
+    
+    explicit StormerExtrapolationIntegrator(int levels = 6);
+    
+    StateVector step(
+        const StateVector& current,
+        double timestep,
+        double mu,
+        const ForceModel& forces
+    ) const override;
+    
+    const char* name() const override;
+    int forceEvaluationsPerStep() const override { return 1 + levels * (levels + 1); }
+    
+private:
+    int levels;
+    
+    // Stormer's rule over n substeps, reusing the initial acceleration
+    StateVector stormer(
+        const StateVector& state,
+        const Vector3D& initialAcceleration,
+        double h,
+        int substeps,
+        double mu,
+        const ForceModel& forces
+    ) const;
+};
+
+// Adams-Bashforth-Moulton predictor-corrector (PECE) of order 8.
+// Reuses the last eight derivatives, so after start-up each step costs two
+// force evaluations. The history is started with GBS12 steps; step() alone
+// has no history and takes a single start-up step.
+class AdamsBashforthMoultonIntegrator : public Integrator {
+public:
+    static constexpr int ORDER = 8;
+    
+    AdamsBashforthMoultonIntegrator();
+    
+    StateVector step(
+        const StateVector& current,
+        double timestep,
+        double mu,
+        const ForceModel& forces
+    ) const override;
+    
+    std::vector<StateVector> integrate(
+        const StateVector& initial,
+        double timestep,
+        size_t steps,
+        double mu,
+        const ForceModel& forces,
+        const std::atomic<bool>* cancel = nullptr
+    ) const override;
+    
+    const char* name() const override { return "ABM8"; }
+    int forceEvaluationsPerStep() const override { return 2; }
+    
+private:
+    double predictor[ORDER];    // Bashforth weights for f_n, f_n-1, ...
+    double corrector[ORDER];    // Moulton weights for f_n+1, f_n, ...
+    StormerExtrapolationIntegrator starter;
+    
+    // Integral over [0, 1] of each Lagrange basis polynomial on `nodes`
+    static void quadratureWeights(const double* nodes, double* weights);
+};
+
+// Encke's method: RK4 on the deviation from an osculating Kepler orbit,
+// which is propagated analytically. The deviation is driven only by the
+// perturbations, so weakly perturbed orbits tolerate much larger steps.
+// integrate() rectifies (restarts the reference from the current state)
+// once the deviation exceeds rectifyRatio of the radius; step() rectifies
+// every step.
+class EnckeIntegrator : public Integrator {
+public:
+    static constexpr double DEFAULT_RECTIFY_RATIO = 1e-3;
+    
+    explicit EnckeIntegrator(double rectifyRatio = DEFAULT_RECTIFY_RATIO);
+    
+    StateVector step(
+        const StateVector& current,
+        double timestep,
+        double mu,
+        const ForceModel& forces
+    ) const override;
+    
+    std::vector<StateVector> integrate(
+        const StateVector& initial,
+        double timestep,
+        size_t steps,
+        double mu,
+        const ForceModel& forces,
+        const std::atomic<bool>* cancel = nullptr
+    ) const override;
+    
+    const char* name() const override { return "Encke"; }
+    int forceEvaluationsPerStep() const override { return 4; }
+    
+private:
+    double rectifyRatio;
+    
+    // Acceleration of the deviation `delta` from reference position `rho`
+    Vector3D deviationAcceleration(
+        const Vector3D& rho,
+        const Vector3D& delta,
+        double mu,
+        const ForceModel& perturbations
+    ) const;
+    
+    // One RK4 step of (delta, deltaVel) from `elapsed` to `elapsed + h` after
+    // the reference epoch. rho0 is the reference state at the start of the
+    // step; rho1 receives it at the end. Shared by step() and integrate().
+    void deviationStep(
+        const StateVector& reference,
+        const StateVector& rho0,
+        double elapsed,
+        double h,
+        double mu,
+        const ForceModel& perturbations,
+        Vector3D& delta,
+        Vector3D& deltaVel,
+        StateVector& rho1
+    ) const;
+};
+
+// RK4 in the Sundman variable s with dt/ds = r, so steps are uniform in an
+// eccentric-anomaly-like phase: short near perigee, long near apogee. The
+// regularized step is the time step divided by the semi-major axis, which
+// keeps the step count per orbit. Output is resampled at the requested
+// times by quintic Hermite interpolation of position, velocity and
+// acceleration at the ends of each regularized step.
+class SundmanIntegrator : public Integrator {
+public:
+    StateVector step(
+        const StateVector& current,
+        double timestep,
+        double mu,
+        const ForceModel& forces
+    ) const override;
+    
+    std::vector<StateVector> integrate(
+        const StateVector& initial,
+        double timestep,
+        size_t steps,
+        double mu,
+        const ForceModel& forces,
+        const std::atomic<bool>* cancel = nullptr
+    ) const override;
+    
+    const char* name() const override { return "Sundman"; }
+    int forceEvaluationsPerStep() const override { return 4; }
+    
+private:
+    // Regularized step for a requested time step h (see class comment)
+    static double regularizedStep(const StateVector& initial, double h, double mu);
+    
+    // One RK4 step of size ds in s from `current` (accel = its acceleration);
+    // shared by step() and integrate()
+    StateVector advance(
+        const StateVector& current,
+        const Vector3D& accel,
+        double ds,
+        double mu,
+        const ForceModel& forces
+    ) const;
+    
+    // State on the interval [a, b] at time t
+    static StateVector interpolate(
+        const StateVector& a, const Vector3D& accelA,
+        const StateVector& b, const Vector3D& accelB,
+        double t
+    );
+};
+
+// Symmetric composition of drift-kick-drift leapfrog substeps.
+// Symplectic, so energy error stays bounded instead of drifting secularly;
+// one force evaluation per substep.
+class SymplecticIntegrator : public Integrator {
+public:
+    StateVector step(
+        const StateVector& current,
+        double timestep,
+        double mu,
+        const ForceModel& forces
+    ) const override;
+    
+    int forceEvaluationsPerStep() const override { return static_cast<int>(weights.size()); }
+    
+protected:
+    // Substep fractions of the timestep (symmetric, summing to one)
+    explicit SymplecticIntegrator(std::vector<double> weights) : weights(std::move(weights)) {}
+    
+    // Yoshida's composition w_m ... w_1 w_0 w_1 ... w_m, w_0 = 1 - 2 * sum(w_i)
+    static std::vector<double> yoshidaWeights(const std::vector<double>& outer);
+    
+private:
+    std::vector<double> weights;
+};
+
+// Stormer-Verlet leapfrog (second-order)
+class LeapfrogIntegrator : public SymplecticIntegrator {
+public:
+    LeapfrogIntegrator() : SymplecticIntegrator({1.0}) {}
+    const char* name() const override { return "Leapfrog"; }
+};
+
+// Yoshida triple jump (fourth-order, 3 substeps)
+class Yoshida4Integrator : public SymplecticIntegrator {
+public:
+    Yoshida4Integrator();
+    const char* name() const override { return "Yoshida4"; }
+};
+
+// Yoshida solution A (sixth-order, 7 substeps)
+class Yoshida6Integrator : public SymplecticIntegrator {
+public:
+    Yoshida6Integrator();
+    const char* name() const override { return "Yoshida6"; }
+};
+
+// Yoshida solution D (eighth-order, 15 substeps)
+class Yoshida8Integrator : public SymplecticIntegrator {
+public:
+    Yoshida8Integrator();
+    const char* name() const override { return "Yoshida8"; }
 };
 
 #endif // INTEGRATOR_H
\ No newline at end of file
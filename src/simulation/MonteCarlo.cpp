@@ -0,0 +1,186 @@
+#include "MonteCarlo.h"
+#include "Integrator.h"
+#include "Eclipse.h"
+#include "Constants.h"
+#include "Profiler.h"
+#include <algorithm>
+#include <cmath>
+#include <mutex>
+#include <random>
+
+// ============================================================================
+// STATISTICS
+// ============================================================================
+
+void EnsembleMoments::add(const double sample[6]) {
+    count++;
+    double before[6];
+    for (int i = 0; i < 6; i++) {
+        before[i] = sample[i] - mean[i];
+        mean[i] += before[i] / count;
+    }
+    for (int i = 0; i < 6; i++) {
+        double after = sample[i] - mean[i];
+        for (int j = 0; j < 6; j++) {
+            comoment[j * 6 + i] += before[j] * after;
+        }
+    }
+}
+
+void EnsembleMoments::merge(const EnsembleMoments& other) {
+    if (other.count == 0) return;
+    if (count == 0) {
+        *this = other;
+        return;
+    }
+
+    // Chan et al. pairwise update
+    double total = static_cast<double>(count + other.count);
+    double weight = static_cast<double>(count) * other.count / total;
+    double delta[6];
+    for (int i = 0; i < 6; i++) {
+        delta[i] = other.mean[i] - mean[i];
+        mean[i] += delta[i] * other.count / total;
+    }
+    for (int i = 0; i < 6; i++) {
+        for (int j = 0; j < 6; j++) {
+            comoment[i * 6 + j] += other.comoment[i * 6 + j] + delta[i] * delta[j] * weight;
+        }
+    }
+    count += other.count;
+}
+
+double EnsembleMoments::positionSpread() const {
+    return std::sqrt(covariance(0, 0) + covariance(1, 1) + covariance(2, 2));
+}
+
+void RunningStatistics::add(double value) {
+    min = (count == 0) ? value : std::min(min, value);
+    max = (count == 0) ? value : std::max(max, value);
+    count++;
+    double before = value - mean;
+    mean += before / count;
+    m2 += before * (value - mean);
+}
+
+void RunningStatistics::merge(const RunningStatistics& other) {
+    if (other.count == 0) return;
+    if (count == 0) {
+        *this = other;
+        return;
+    }
+
+    double total = static_cast<double>(count + other.count);
+    double delta = other.mean - mean;
+    mean += delta * other.count / total;
+    m2 += other.m2 + delta * delta * count * other.count / total;
+    min = std::min(min, other.min);
+    max = std::max(max, other.max);
+    count += other.count;
+}
+
+double RunningStatistics::stddev() const {
+    return std::sqrt(variance());
+}
+
+// ============================================================================
+// ENSEMBLE PROPAGATION
+// ============================================================================
+
+MonteCarloPropagator::MonteCarloPropagator(double gravitationalParameter, size_t threadCount)
+    : mu(gravitationalParameter), forceModel(), pool(threadCount) {}
+
+MonteCarloResult MonteCarloPropagator::run(
+    const StateVector& nominal,
+    const MonteCarloSettings& settings,
+    const std::atomic<bool>* cancel
+) {
+    MDV_PROFILE_SCOPE("Monte Carlo");
+
+    size_t steps = static_cast<size_t>(settings.duration / settings.timestep);
+    size_t interval = std::max<size_t>(settings.outputInterval, 1);
+    size_t epochCount = steps / interval + 1;
+
+    MonteCarloResult result;
+    result.times.resize(epochCount);
+    result.epochs.resize(epochCount);
+    for (size_t e = 0; e < epochCount; e++) {
+        result.times[e] = e * interval * settings.timestep;
+    }
+
+    std::mutex resultMutex;
+    size_t batchCount = (settings.members + StateBatch::WIDTH - 1) / StateBatch::WIDTH;
+    ForceModel forces = forceModel;
+
+    for (size_t batchIndex = 0; batchIndex < batchCount; batchIndex++) {
+        pool.submit([&, batchIndex]() {
+            if (cancel && cancel->load(std::memory_order_relaxed)) return;
+
+            // Samples depend only on the seed and the batch, not on scheduling
+            std::mt19937_64 rng(settings.seed * 0x9E3779B97F4A7C15ull + batchIndex);
+            std::normal_distribution<double> position(0.0, settings.dispersion.positionSigma);
+            std::normal_distribution<double> velocity(0.0, settings.dispersion.velocitySigma);
+
+            StateBatch batch;
+            batch.count = std::min(StateBatch::WIDTH, settings.members - batchIndex * StateBatch::WIDTH);
+            for (size_t i = 0; i < batch.count; i++) {
+                batch.x[i] = nominal.position.x + position(rng);
+                batch.y[i] = nominal.position.y + position(rng);
+                batch.z[i] = nominal.position.z + position(rng);
+                batch.vx[i] = nominal.velocity.x + velocity(rng);
+                batch.vy[i] = nominal.velocity.y + velocity(rng);
+                batch.vz[i] = nominal.velocity.z + velocity(rng);
+            }
+
+            std::vector<EnsembleMoments> epochs(epochCount);
+            RunningStatistics eclipseEntry;
+            double lastDepth[StateBatch::WIDTH];
+            bool entered[StateBatch::WIDTH] = {};
+
+            auto record = [&](size_t epoch) {
+                for (size_t i = 0; i < batch.count; i++) {
+                    const double sample[6] = {batch.x[i], batch.y[i], batch.z[i],
+                                              batch.vx[i], batch.vy[i], batch.vz[i]};
+                    epochs[epoch].add(sample);
+                }
+            };
+
+            // Entry time from linear interpolation of the umbra depth
+            auto checkEclipse = [&](double t) {
+                for (size_t i = 0; i < batch.count; i++) {
+                    double depth = EclipseDetector::checkEclipse(
+                        Vector3D(batch.x[i], batch.y[i], batch.z[i]),
+                        settings.sunDirection, EARTH_RADIUS).umbraDepth;
+                    if (t > 0.0 && depth > 0.0 && lastDepth[i] <= 0.0 && !entered[i]) {
+                        double fraction = -lastDepth[i] / (depth - lastDepth[i]);
+                        eclipseEntry.add(t - (1.0 - fraction) * settings.timestep);
+                        entered[i] = true;
+                    }
+                    lastDepth[i] = depth;
+                }
+            };
+
+            RK4Integrator integrator;
+            record(0);
+            if (settings.eclipseTiming) checkEclipse(0.0);
+
+            for (size_t step = 1; step <= steps; step++) {
+                if (cancel && cancel->load(std::memory_order_relaxed)) return;
+
+                integrator.stepBatch(batch, settings.timestep, mu, forces);
+                if (step % interval == 0) record(step / interval);
+                if (settings.eclipseTiming) checkEclipse(step * settings.timestep);
+            }
+
+            std::lock_guard<std::mutex> lock(resultMutex);
+            for (size_t e = 0; e < epochCount; e++) {
+                result.epochs[e].merge(epochs[e]);
+            }
+            result.eclipseEntry.merge(eclipseEntry);
+            result.members += batch.count;
+        });
+    }
+
+    pool.waitIdle();
+    return result;
+}
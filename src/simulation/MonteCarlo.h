@@ -0,0 +1,102 @@
+#ifndef MONTE_CARLO_H
+#define MONTE_CARLO_H
+
+#include "StateVector.h"
+#include "ForceModel.h"
+#include "ThreadPool.h"
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+// Running mean and covariance of (x, y, z, vx, vy, vz) samples (Welford).
+// Partial results from different threads combine exactly with merge().
+struct EnsembleMoments {
+    size_t count = 0;
+    double mean[6] = {};
+    double comoment[36] = {};    // Sum of (x - mean)(x - mean)^T, row-major
+
+    void add(const double sample[6]);
+    void merge(const EnsembleMoments& other);
+
+    // Sample covariance (km, km/s)
+    double covariance(int row, int col) const {
+        return (count > 1) ? comoment[row * 6 + col] / (count - 1) : 0.0;
+    }
+
+    Vector3D meanPosition() const { return Vector3D(mean[0], mean[1], mean[2]); }
+
+    // Root of the position covariance trace (km)
+    double positionSpread() const;
+};
+
+// Running mean/variance/range of a scalar (e.g. an event time)
+struct RunningStatistics {
+    size_t count = 0;
+    double mean = 0.0;
+    double m2 = 0.0;            // Sum of squared deviations
+    double min = 0.0;
+    double max = 0.0;
+
+    void add(double value);
+    void merge(const RunningStatistics& other);
+
+    double variance() const { return (count > 1) ? m2 / (count - 1) : 0.0; }
+    double stddev() const;
+};
+
+// Independent Gaussian dispersion of the initial state, per axis (1-sigma)
+struct DispersionModel {
+    double positionSigma = 0.1;     // km
+    double velocitySigma = 1e-4;    // km/s
+};
+
+struct MonteCarloSettings {
+    size_t members = 1000;
+    double duration = 0.0;          // seconds
+    double timestep = 60.0;         // seconds
+    size_t outputInterval = 1;      // Steps between statistics epochs
+    uint64_t seed = 1;              // Same seed and settings give the same samples
+    DispersionModel dispersion;
+
+    // First umbra entry time of every member
+    bool eclipseTiming = false;
+    Vector3D sunDirection;          // Unit vector towards the Sun
+};
+
+struct MonteCarloResult {
+    size_t members = 0;                     // Members that completed
+    std::vector<double> times;              // Seconds after the nominal state, per epoch
+    std::vector<EnsembleMoments> epochs;    // Ensemble statistics per epoch
+    RunningStatistics eclipseEntry;         // Over the members that entered umbra
+};
+
+// Dispersion analysis: propagates many perturbed copies of a state on a
+// thread pool and reduces them to per-epoch statistics as it goes.
+//
+// Members are stepped in StateBatch blocks with RK4Integrator::stepBatch.
+// Each task keeps its own statistics and merges them into the result when
+// it finishes, so memory grows with the number of epochs, not with
+// members x steps.
+class MonteCarloPropagator {
+public:
+    explicit MonteCarloPropagator(double mu, size_t threadCount = 0);
+
+    void setForceModel(const ForceModel& model) { forceModel = model; }
+    const ForceModel& getForceModel() const { return forceModel; }
+
+    // Blocks until the ensemble is done (or cancel is set; the result then
+    // covers the batches that completed)
+    MonteCarloResult run(
+        const StateVector& nominal,
+        const MonteCarloSettings& settings,
+        const std::atomic<bool>* cancel = nullptr
+    );
+
+private:
+    double mu;
+    ForceModel forceModel;
+    ThreadPool pool;
+};
+
+#endif // MONTE_CARLO_H
@@ -1,4 +1,5 @@
 #include "OrbitPropagator.h"
+#include "Profiler.h"
 
 OrbitPropagator::OrbitPropagator(double gravitationalParameter)
     : mu(gravitationalParameter), forceModel() {  // Initialize with default force model
@@ -9,22 +10,62 @@ OrbitPropagator::OrbitPropagator(double gravitationalParameter)
 std::vector<StateVector> OrbitPropagator::propagate(
     const StateVector& initialState,
     double duration,
-    double timestep
+    double timestep,
+    const std::atomic<bool>* cancel
 ) {
-    std::vector<StateVector> trajectory;
-    StateVector current = initialState;
-    trajectory.push_back(current);
+    MDV_PROFILE_SCOPE("Propagate");
+    size_t numSteps = static_cast<size_t>(duration / timestep);
+    return integrator->integrate(initialState, timestep, numSteps, mu, forceModel, cancel);
+}
+
+std::vector<StateVector> OrbitPropagator::propagateWithTransition(
+    const StateVector& initialState,
+    double duration,
+    double timestep,
+    std::vector<StateTransitionMatrix>& transitions,
+    const std::atomic<bool>* cancel
+) {
+    MDV_PROFILE_SCOPE("Propagate STM");
+    size_t numSteps = static_cast<size_t>(duration / timestep);
     
-    int numSteps = static_cast<int>(duration / timestep);
+    std::vector<StateVector> trajectory;
+    trajectory.reserve(numSteps + 1);
+    trajectory.push_back(initialState);
+    transitions.clear();
+    transitions.reserve(numSteps + 1);
+    transitions.push_back(StateTransitionMatrix::identity());
     
-    for (int i = 0; i < numSteps; ++i) {
-        current = integrator->step(current, timestep, mu, forceModel);  // Pass force model
+    StateVector current = initialState;
+    StateTransitionMatrix phi = StateTransitionMatrix::identity();
+    for (size_t i = 0; i < numSteps; ++i) {
+        if (cancel && cancel->load(std::memory_order_relaxed)) break;
+        
+        current = integrator->stepVariational(current, phi, timestep, mu, forceModel);
         trajectory.push_back(current);
+        transitions.push_back(phi);
     }
     
     return trajectory;
 }
 
+ChebyshevEphemeris OrbitPropagator::propagateEphemeris(
+    const StateVector& initialState,
+    double duration,
+    double timestep,
+    int degree,
+    double tolerance,
+    double* sampleStep
+) {
+    ChebyshevEphemeris ephemeris;
+    for (int refinement = 0; refinement <= MAX_EPHEMERIS_REFINEMENTS; refinement++) {
+        if (refinement > 0) timestep *= 0.5;
+        ephemeris = ChebyshevEphemeris::fit(propagate(initialState, duration, timestep), degree, tolerance);
+        if (ephemeris.withinTolerance()) break;
+    }
+    if (sampleStep) *sampleStep = timestep;
+    return ephemeris;
+}
+
 StateVector OrbitPropagator::step(
     const StateVector& current,
     double timestep
@@ -4,6 +4,8 @@
 #include "StateVector.h"
 #include "Integrator.h"
 #include "ForceModel.h"
+#include "ChebyshevEphemeris.h"
+#include <atomic>
 #include <memory>
 #include <vector>
 
@@ -17,10 +19,37 @@ public:
     OrbitPropagator(double gravitationalParameter);
     
     // Propagate for a specified duration
+    // (stops early and returns the partial trajectory if cancel is set)
     std::vector<StateVector> propagate(
         const StateVector& initialState,
         double duration,
-        double timestep
+        double timestep,
+        const std::atomic<bool>* cancel = nullptr
+    );
+    
+    // Propagate together with the state transition matrix of every sample,
+    // transitions[k] = Phi(t_k, t_0), from the variational equations
+    std::vector<StateVector> propagateWithTransition(
+        const StateVector& initialState,
+        double duration,
+        double timestep,
+        std::vector<StateTransitionMatrix>& transitions,
+        const std::atomic<bool>* cancel = nullptr
+    );
+    
+    // Propagate and fit the result into Chebyshev segments
+    // (tolerance: max position error on the propagated samples, km).
+    // The step is halved, up to MAX_EPHEMERIS_REFINEMENTS times, while the
+    // samples are too sparse for the fit; check withinTolerance(). The step
+    // finally used is written to sampleStep if given.
+    static constexpr int MAX_EPHEMERIS_REFINEMENTS = 4;
+    ChebyshevEphemeris propagateEphemeris(
+        const StateVector& initialState,
+        double duration,
+        double timestep,
+        int degree = ChebyshevEphemeris::DEFAULT_DEGREE,
+        double tolerance = ChebyshevEphemeris::DEFAULT_TOLERANCE,
+        double* sampleStep = nullptr
     );
     
     // Single step
@@ -31,6 +60,7 @@ public:
     
     // Change integration method
     void setIntegrator(std::unique_ptr<Integrator> newIntegrator);
+    const Integrator& getIntegrator() const { return *integrator; }
 
     void setForceModel(const ForceModel& model) { forceModel = model; }
     ForceModel& getForceModel() { return forceModel; }
@@ -1,26 +1,70 @@
 #include "Satellite.h"
 #include "Constants.h"
 
-Satellite::Satellite(const OrbitPreset& p, const std::vector<StateVector>& o)
-    : orbit(o), currentFrame(0), preset(p), visible(true) {
+Satellite::Satellite(const OrbitPreset& p, std::shared_ptr<const CompactTrajectory> o)
+    : orbit(std::move(o)), currentFrame(0), preset(p), visible(true) {
+    decodeRecentStates();
     calculateStatistics(EARTH_RADIUS);
 }
 
-void Satellite::advanceFrames(size_t frames) {
-    if (visible && !orbit.empty()) {
-        currentFrame = (currentFrame + frames) % orbit.size();
+void Satellite::setOrbit(std::shared_ptr<const CompactTrajectory> newOrbit) {
+    if (!newOrbit || newOrbit->empty()) return;
+    
+    orbit = std::move(newOrbit);
+    elementHistory.reset();
+    currentFrame %= orbit->size();
+    decodeRecentStates();
+    calculateStatistics(EARTH_RADIUS);
+}
+
+void Satellite::setCurrentFrame(size_t frame) {
+    if (orbit->empty()) return;
+    
+    frame %= orbit->size();
+    if (frame == currentFrame) return;
+    currentFrame = frame;
+    decodeRecentStates();
+}
+
+void Satellite::decodeRecentStates() {
+    // clear() keeps the capacity, so per-frame updates do not allocate
+    recentStates.clear();
+    if (orbit->empty()) {
+        recentStates.push_back(StateVector());
+        return;
+    }
+    
+    size_t first = (currentFrame > TRAIL_LENGTH) ? currentFrame - TRAIL_LENGTH : 0;
+    orbit->decodeRange(first, currentFrame - first + 1, recentStates);
+}
+
+const std::vector<OrbitalElements>& Satellite::getElementHistory() const {
+    if (!elementHistory) {
+        elementHistory = std::make_shared<const std::vector<OrbitalElements>>(
+            OrbitalElements::fromStateVectors(orbit->decode(), MU_EARTH));
     }
+    return *elementHistory;
+}
+
+OrbitalElements Satellite::getCurrentElements() const {
+    return OrbitalElements::fromStateVector(getCurrentState(), MU_EARTH);
 }
 
 void Satellite::calculateStatistics(double earthRadius) {
-    if (orbit.empty()) return;
+    if (orbit->empty()) return;
+    stats = computeStatistics(orbit->decode(), earthRadius);
+}
+
+OrbitStatistics Satellite::computeStatistics(const std::vector<StateVector>& states, double earthRadius) {
+    OrbitStatistics stats{};
+    if (states.empty()) return stats;
     
     double minR = 1e10, maxR = 0;
     size_t periIdx = 0, apoIdx = 0;
     
     // Find periapsis and apoapsis
-    for (size_t i = 0; i < orbit.size(); i++) {
-        double r = orbit[i].position.magnitude();
+    for (size_t i = 0; i < states.size(); i++) {
+        double r = states[i].position.magnitude();
         if (r < minR) {
             minR = r;
             periIdx = i;
@@ -34,22 +78,24 @@ void Satellite::calculateStatistics(double earthRadius) {
     // Calculate altitudes
     stats.periapsisAlt = minR - earthRadius;
     stats.apoapsisAlt = maxR - earthRadius;
-    stats.periapsisVel = orbit[periIdx].velocity.magnitude();
-    stats.apoapsisVel = orbit[apoIdx].velocity.magnitude();
+    stats.periapsisVel = states[periIdx].velocity.magnitude();
+    stats.apoapsisVel = states[apoIdx].velocity.magnitude();
     stats.meanAltitude = (stats.periapsisAlt + stats.apoapsisAlt) / 2.0;
     
     // Classify orbit family
     if (stats.meanAltitude < LEO_MAX_ALTITUDE) {
         stats.orbitFamily = "LEO";
-        stats.familyColor = Color{100, 200, 255, 255};
+        stats.family = OrbitFamily::LEO;
     } else if (stats.meanAltitude < MEO_MAX_ALTITUDE) {
         stats.orbitFamily = "MEO";
-        stats.familyColor = Color{100, 255, 100, 255};
+        stats.family = OrbitFamily::MEO;
     } else if (stats.apoapsisAlt > MEO_MAX_ALTITUDE && stats.periapsisAlt < MEO_MAX_ALTITUDE) {
         stats.orbitFamily = "HEO";
-        stats.familyColor = Color{255, 150, 100, 255};
+        stats.family = OrbitFamily::HEO;
     } else {
         stats.orbitFamily = "GEO";
-        stats.familyColor = Color{255, 100, 255, 255};
+        stats.family = OrbitFamily::GEO;
     }
+    
+    return stats;
 }
\ No newline at end of file
@@ -3,9 +3,19 @@
 
 #include <vector>
 #include <string>
+#include <memory>
 #include "StateVector.h"
+#include "CompactTrajectory.h"
+#include "OrbitalElements.h"
 #include "OrbitPresets.h"
-#include "raylib.h"
+
+// Orbit family classification
+enum class OrbitFamily {
+    LEO,
+    MEO,
+    HEO,
+    GEO
+};
 
 // Orbit statistics
 struct OrbitStatistics {
@@ -15,40 +25,56 @@ struct OrbitStatistics {
     double apoapsisVel;
     double meanAltitude;
     std::string orbitFamily;
-    Color familyColor;
+    OrbitFamily family;
 };
 
 // Satellite class - encapsulates all satellite data and behavior
 class Satellite {
 public:
     // Constructor
-    Satellite(const OrbitPreset& preset, const std::vector<StateVector>& orbit);
+    // The trajectory stays compact in memory and is decoded on access; it
+    // may be shared with the simulation thread or view a mapped cache file
+    Satellite(const OrbitPreset& preset, std::shared_ptr<const CompactTrajectory> orbit);
     
     // Getters
-    const std::vector<StateVector>& getOrbit() const { return orbit; }
+    const CompactTrajectory& getOrbit() const { return *orbit; }
     size_t getCurrentFrame() const { return currentFrame; }
-    const StateVector& getCurrentState() const { return orbit[currentFrame]; }
+    const StateVector& getCurrentState() const { return recentStates.back(); }
     const OrbitPreset& getPreset() const { return preset; }
     const OrbitStatistics& getStats() const { return stats; }
     bool isVisible() const { return visible; }
     
+    // Decoded states from TRAIL_LENGTH frames back (fewer near the start)
+    // up to and including the current one
+    const std::vector<StateVector>& getRecentStates() const { return recentStates; }
+    
+    // Shared, immutable trajectory handle (safe to read from other threads)
+    std::shared_ptr<const CompactTrajectory> getTrajectory() const { return orbit; }
+    
+    // Osculating elements of every trajectory sample (e.g. for RAAN / periapsis
+    // drift plots). Decoded and converted in one batch on first use after the
+    // trajectory changes, so only satellites that are actually inspected pay for it.
+    const std::vector<OrbitalElements>& getElementHistory() const;
+    OrbitalElements getCurrentElements() const;
+    
     // Setters
     void setVisible(bool vis) { visible = vis; }
-    void setCurrentFrame(size_t frame) { 
-        if (!orbit.empty()) {
-            currentFrame = frame % orbit.size(); 
-        }
-    }
+    void setCurrentFrame(size_t frame);
     
-    // Update
-    void advanceFrames(size_t frames);
+    // Replace the trajectory (e.g. after re-propagation); keeps the frame
+    void setOrbit(std::shared_ptr<const CompactTrajectory> newOrbit);
     
     // Statistics
     void calculateStatistics(double earthRadius);
+    static OrbitStatistics computeStatistics(const std::vector<StateVector>& states, double earthRadius);
     
 private:
-    std::vector<StateVector> orbit;
+    std::shared_ptr<const CompactTrajectory> orbit;
+    mutable std::shared_ptr<const std::vector<OrbitalElements>> elementHistory;
     size_t currentFrame;
+    std::vector<StateVector> recentStates;  // Never empty
+    
+    void decodeRecentStates();
     OrbitPreset preset;
     bool visible;
     OrbitStatistics stats;
@@ -0,0 +1,153 @@
+#include "SimulationWorker.h"
+#include "Constants.h"
+#include "Profiler.h"
+#include <chrono>
+
+SimulationWorker::SimulationWorker(double rate)
+    : tickRate(rate), sunDirection(1.0, 0.0, 0.0), running(false),
+      animationSpeed(1.0f), frameAccumulator(0.0), tick(0) {}
+
+SimulationWorker::~SimulationWorker() {
+    stop();
+}
+
+void SimulationWorker::start(const std::vector<Satellite>& satellites, const Vector3D& sunDir) {
+    stop();
+
+    sunDirection = sunDir;
+    trajectories.clear();
+    frames.clear();
+    visibility.reset(new std::atomic<bool>[satellites.size()]);
+
+    for (size_t i = 0; i < satellites.size(); i++) {
+        trajectories.push_back(satellites[i].getTrajectory());
+        frames.push_back(satellites[i].getCurrentFrame());
+        visibility[i].store(satellites[i].isVisible(), std::memory_order_relaxed);
+    }
+
+    // Seed the reader with a complete snapshot so the first frame has data
+    frameAccumulator = 0.0;
+    tick = 0;
+    publish();
+    snapshots.update();
+
+    running.store(true);
+    thread = std::thread(&SimulationWorker::run, this);
+}
+
+void SimulationWorker::stop() {
+    if (!running.exchange(false)) return;
+    if (thread.joinable()) {
+        thread.join();
+    }
+}
+
+void SimulationWorker::setAnimationSpeed(float speed) {
+    animationSpeed.store(speed, std::memory_order_relaxed);
+}
+
+void SimulationWorker::setSatelliteVisible(size_t index, bool visible) {
+    if (index < trajectories.size()) {
+        visibility[index].store(visible, std::memory_order_relaxed);
+    }
+}
+
+void SimulationWorker::setTrajectory(
+    size_t index,
+    std::shared_ptr<const CompactTrajectory> trajectory
+) {
+    if (index < trajectories.size() && trajectory) {
+        std::atomic_store(&trajectories[index], std::move(trajectory));
+    }
+}
+
+const SimulationSnapshot& SimulationWorker::latestSnapshot() {
+    snapshots.update();
+    return snapshots.readBuffer();
+}
+
+void SimulationWorker::run() {
+    using clock = std::chrono::steady_clock;
+    const auto period = std::chrono::duration_cast<clock::duration>(
+        std::chrono::duration<double>(1.0 / tickRate));
+
+    Profiler::setThreadName("Simulation");
+
+    auto nextTick = clock::now();
+    while (running.load(std::memory_order_relaxed)) {
+        {
+            MDV_PROFILE_SCOPE("SimulationTick");
+            advance();
+            publish();
+        }
+
+        nextTick += period;
+        auto now = clock::now();
+        if (nextTick < now) {
+            // Fell behind (e.g. debugger pause) - don't try to catch up
+            nextTick = now;
+        }
+        std::this_thread::sleep_until(nextTick);
+    }
+}
+
+void SimulationWorker::advance() {
+    float speed = animationSpeed.load(std::memory_order_relaxed);
+    if (speed <= 0.01f) return;
+
+    // Accumulate fractional frames so speeds below 1x actually slow down
+    frameAccumulator += speed;
+    size_t framesToAdvance = static_cast<size_t>(frameAccumulator);
+    frameAccumulator -= static_cast<double>(framesToAdvance);
+
+    for (size_t i = 0; i < frames.size(); i++) {
+        if (!visibility[i].load(std::memory_order_relaxed)) continue;
+
+        size_t count = std::atomic_load(&trajectories[i])->size();
+        if (count == 0) continue;
+        frames[i] = (frames[i] + framesToAdvance) % count;
+    }
+}
+
+void SimulationWorker::publish() {
+    SimulationSnapshot& snapshot = snapshots.writeBuffer();
+
+    snapshot.tick = ++tick;
+    snapshot.frames.resize(frames.size());
+    snapshot.eclipse.resize(frames.size());
+
+    // One probe for the whole pass; a per-satellite scope would flood the
+    // profiler ring at catalog scale
+    MDV_PROFILE_SCOPE("Eclipse");
+    size_t eclipseChecks = 0;
+
+    for (size_t i = 0; i < frames.size(); i++) {
+        std::shared_ptr<const CompactTrajectory> trajectory =
+            std::atomic_load(&trajectories[i]);
+
+        if (trajectory->empty()) {
+            snapshot.frames[i] = 0;
+            snapshot.eclipse[i] = EclipseStatus();
+            continue;
+        }
+
+        // Trajectory may have been replaced with a shorter one
+        if (frames[i] >= trajectory->size()) {
+            frames[i] %= trajectory->size();
+        }
+        snapshot.frames[i] = frames[i];
+
+        if (visibility[i].load(std::memory_order_relaxed)) {
+            // Decoded on demand; hidden satellites cost nothing
+            StateVector state = trajectory->state(frames[i]);
+            snapshot.eclipse[i] = EclipseDetector::checkEclipse(
+                state.position, sunDirection, EARTH_RADIUS);
+            eclipseChecks++;
+        } else {
+            snapshot.eclipse[i] = EclipseStatus();
+        }
+    }
+    MDV_PROFILE_COUNTER("Eclipse checks", eclipseChecks);
+
+    snapshots.publish();
+}
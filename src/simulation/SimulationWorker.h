@@ -0,0 +1,82 @@
+#ifndef SIMULATION_WORKER_H
+#define SIMULATION_WORKER_H
+
+#include "StateVector.h"
+#include "CompactTrajectory.h"
+#include "Eclipse.h"
+#include "Satellite.h"
+#include "TripleBuffer.h"
+#include "Constants.h"
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <thread>
+#include <vector>
+
+// Everything the renderer needs from one simulation tick
+struct SimulationSnapshot {
+    uint64_t tick;                       // Monotonic tick counter
+    std::vector<size_t> frames;          // Current trajectory frame per satellite
+    std::vector<EclipseStatus> eclipse;  // Eclipse status per satellite
+
+    SimulationSnapshot() : tick(0) {}
+};
+
+// Dedicated simulation thread.
+//
+// Advances satellite animation and runs per-tick analysis at a fixed rate,
+// publishing each result through a lock-free triple buffer. The render loop
+// only ever reads the newest complete snapshot and never waits on physics.
+class SimulationWorker {
+public:
+    explicit SimulationWorker(double tickRate = SIMULATION_TICK_RATE);
+    ~SimulationWorker();
+
+    SimulationWorker(const SimulationWorker&) = delete;
+    SimulationWorker& operator=(const SimulationWorker&) = delete;
+
+    // Start the worker (publishes an initial snapshot before returning)
+    void start(const std::vector<Satellite>& satellites, const Vector3D& sunDirection);
+
+    // Stop and join the worker thread
+    void stop();
+
+    bool isRunning() const { return running.load(std::memory_order_relaxed); }
+
+    // Main-thread controls (lock-free, picked up on the next tick)
+    void setAnimationSpeed(float speed);
+    void setSatelliteVisible(size_t index, bool visible);
+
+    // Replace a satellite's trajectory (frame is clamped on the next tick)
+    void setTrajectory(size_t index, std::shared_ptr<const CompactTrajectory> trajectory);
+
+    // Main-thread read of the newest published snapshot
+    const SimulationSnapshot& latestSnapshot();
+
+private:
+    double tickRate;
+    Vector3D sunDirection;
+
+    std::thread thread;
+    std::atomic<bool> running;
+
+    // Controls written by the main thread
+    std::atomic<float> animationSpeed;
+    std::unique_ptr<std::atomic<bool>[]> visibility;
+
+    // Trajectory handles, swapped with std::atomic_load/atomic_store
+    std::vector<std::shared_ptr<const CompactTrajectory>> trajectories;
+
+    // Worker-owned state
+    std::vector<size_t> frames;
+    double frameAccumulator;
+    uint64_t tick;
+
+    TripleBuffer<SimulationSnapshot> snapshots;
+
+    void run();
+    void advance();
+    void publish();
+};
+
+#endif // SIMULATION_WORKER_H
@@ -6,13 +6,6 @@ SolarPanelAnalysis::SolarPanelAnalysis()
     : betaAngle(0), sunElevation(0), solarEfficiency(0),
       sunVector(0, 0, 0), inSunlight(true) {}
 
-Color SolarPanelAnalysis::getEfficiencyColor() const {
-    if (solarEfficiency > 0.8) return GREEN;
-    if (solarEfficiency > 0.5) return YELLOW;
-    if (solarEfficiency > 0.2) return ORANGE;
-    return RED;
-}
-
 const char* SolarPanelAnalysis::getPowerStatus() const {
     if (!inSunlight) return "Battery Mode";
     if (solarEfficiency > 0.8) return "Optimal Generation";
@@ -3,7 +3,6 @@
 
 #include "Vector3D.h"
 #include "Eclipse.h"
-#include "raylib.h"
 
 // Solar panel analysis structure
 struct SolarPanelAnalysis {
@@ -15,9 +14,6 @@ struct SolarPanelAnalysis {
     
     SolarPanelAnalysis();
     
-    // Get color based on efficiency
-    Color getEfficiencyColor() const;
-    
     // Get power status string
     const char* getPowerStatus() const;
 };
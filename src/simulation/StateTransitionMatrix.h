@@ -0,0 +1,25 @@
+#ifndef STATE_TRANSITION_MATRIX_H
+#define STATE_TRANSITION_MATRIX_H
+
+/**
+ * 6x6 state transition matrix: d(r, v)(t) / d(r, v)(t0).
+ *
+ * Row-major, rows and columns ordered x, y, z, vx, vy, vz. A small change
+ * d0 in the initial state moves the state at t by approximately phi * d0.
+ */
+struct StateTransitionMatrix {
+    double m[36];
+
+    static StateTransitionMatrix identity() {
+        StateTransitionMatrix phi;
+        for (int i = 0; i < 36; i++) {
+            phi.m[i] = (i % 7 == 0) ? 1.0 : 0.0;
+        }
+        return phi;
+    }
+
+    double operator()(int row, int col) const { return m[row * 6 + col]; }
+    double& operator()(int row, int col) { return m[row * 6 + col]; }
+};
+
+#endif // STATE_TRANSITION_MATRIX_H
@@ -0,0 +1,67 @@
+#include "ThreadPool.h"
+#include "Profiler.h"
+
+ThreadPool::ThreadPool(size_t threadCount)
+    : activeTasks(0), stopping(false) {
+    if (threadCount == 0) {
+        threadCount = std::thread::hardware_concurrency();
+        if (threadCount == 0) threadCount = 2;
+    }
+
+    for (size_t i = 0; i < threadCount; i++) {
+        workers.emplace_back(&ThreadPool::workerLoop, this);
+    }
+}
+
+ThreadPool::~ThreadPool() {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        stopping = true;
+    }
+    taskAvailable.notify_all();
+
+    for (auto& worker : workers) {
+        worker.join();
+    }
+}
+
+void ThreadPool::submit(std::function<void()> task) {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        tasks.push_back(std::move(task));
+    }
+    taskAvailable.notify_one();
+}
+
+void ThreadPool::waitIdle() {
+    std::unique_lock<std::mutex> lock(mutex);
+    idle.wait(lock, [this] { return tasks.empty() && activeTasks == 0; });
+}
+
+void ThreadPool::workerLoop() {
+    Profiler::setThreadName("Worker");
+
+    while (true) {
+        std::function<void()> task;
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            taskAvailable.wait(lock, [this] { return stopping || !tasks.empty(); });
+
+            if (stopping && tasks.empty()) return;
+
+            task = std::move(tasks.front());
+            tasks.pop_front();
+            activeTasks++;
+        }
+
+        task();
+
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            activeTasks--;
+            if (tasks.empty() && activeTasks == 0) {
+                idle.notify_all();
+            }
+        }
+    }
+}
@@ -0,0 +1,44 @@
+#ifndef THREAD_POOL_H
+#define THREAD_POOL_H
+
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// Fixed-size worker pool for background computation (propagation, analysis)
+class ThreadPool {
+public:
+    // threadCount == 0 uses all hardware threads
+    explicit ThreadPool(size_t threadCount = 0);
+    ~ThreadPool();
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    // Queue a task; runs on the first free worker
+    void submit(std::function<void()> task);
+
+    // Block until the queue is empty and all workers are idle
+    void waitIdle();
+
+    size_t size() const { return workers.size(); }
+
+private:
+    std::vector<std::thread> workers;
+    std::deque<std::function<void()>> tasks;
+
+    std::mutex mutex;
+    std::condition_variable taskAvailable;
+    std::condition_variable idle;
+
+    size_t activeTasks;
+    bool stopping;
+
+    void workerLoop();
+};
+
+#endif // THREAD_POOL_H
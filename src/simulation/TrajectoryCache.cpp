@@ -0,0 +1,254 @@
+#include "TrajectoryCache.h"
+#include <atomic>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <type_traits>
+
+static_assert(std::is_trivially_copyable<StateVector>::value,
+              "StateVector is hashed into cache keys byte for byte");
+
+namespace {
+    const char FILE_MAGIC[8] = {'M', 'D', 'V', 'T', 'R', 'A', 'J', '\0'};
+
+    struct FileHeader {
+        char magic[8];
+        uint32_t version;
+        uint32_t encoding;         // TrajectoryEncoding of the states
+        uint64_t keyHash;
+        uint64_t keySize;
+        uint64_t stateCount;
+        uint64_t trajectoryBytes;  // Serialized CompactTrajectory, 8-aligned
+        uint64_t stationCount;
+        uint64_t windowCount;      // Total over all stations
+    };
+
+    struct WindowRecord {
+        double startTime;
+        double endTime;
+        double maxElevation;
+        uint64_t startFrame;
+        uint64_t endFrame;
+    };
+
+    // FNV-1a
+    uint64_t hashKey(const std::string& key) {
+        uint64_t hash = 14695981039346656037ull;
+        for (unsigned char c : key) {
+            hash ^= c;
+            hash *= 1099511628211ull;
+        }
+        return hash;
+    }
+
+    size_t align8(size_t offset) {
+        return (offset + 7) & ~static_cast<size_t>(7);
+    }
+
+    template <typename T>
+    void append(std::string& blob, const T& value) {
+        blob.append(reinterpret_cast<const char*>(&value), sizeof(T));
+    }
+
+    void appendString(std::string& blob, const std::string& text) {
+        append(blob, static_cast<uint64_t>(text.size()));
+        blob.append(text);
+    }
+}
+
+std::vector<AccessStatistics> CachedTrajectory::accessStatistics() const {
+    std::vector<AccessStatistics> stats(stationCount);
+
+    const uint64_t* counts = reinterpret_cast<const uint64_t*>(file->data() + windowCountsOffset);
+    const WindowRecord* record = reinterpret_cast<const WindowRecord*>(file->data() + windowsOffset);
+
+    for (size_t s = 0; s < stationCount; s++) {
+        for (uint64_t w = 0; w < counts[s]; w++, record++) {
+            stats[s].windows.emplace_back(record->startTime, record->endTime, record->maxElevation,
+                                          static_cast<size_t>(record->startFrame),
+                                          static_cast<size_t>(record->endFrame));
+        }
+        stats[s].calculate();
+    }
+    return stats;
+}
+
+TrajectoryCache::TrajectoryCache(const std::string& dir)
+    : directory(dir) {}
+
+std::string TrajectoryCache::makeKey(
+    const StateVector& initialState,
+    double duration,
+    double timestep,
+    double mu,
+    const ForceModel& forceModel,
+    const std::string& integratorName,
+    const std::vector<GroundStation>& groundStations
+) {
+    std::string key;
+    append(key, CACHE_VERSION);
+    append(key, initialState);
+    append(key, duration);
+    append(key, timestep);
+    append(key, mu);
+
+    uint32_t flags = 0;
+    const bool forceFlags[] = {
+        forceModel.pointMass, forceModel.j2Perturbation, forceModel.j3Perturbation,
+        forceModel.j4Perturbation, forceModel.atmosphericDrag, forceModel.solarRadiation,
+        forceModel.thirdBodyMoon, forceModel.thirdBodySun
+    };
+    for (size_t i = 0; i < sizeof(forceFlags) / sizeof(forceFlags[0]); i++) {
+        if (forceFlags[i]) flags |= 1u << i;
+    }
+    append(key, flags);
+
+    appendString(key, integratorName);
+
+    append(key, static_cast<uint64_t>(groundStations.size()));
+    for (const auto& station : groundStations) {
+        append(key, station.location.latitude);
+        append(key, station.location.longitude);
+        append(key, station.location.altitude);
+        append(key, station.minElevation);
+    }
+    return key;
+}
+
+std::string TrajectoryCache::pathFor(uint64_t hash) const {
+    char name[32];
+    std::snprintf(name, sizeof(name), "%016llx.traj", static_cast<unsigned long long>(hash));
+    return (std::filesystem::path(directory) / name).string();
+}
+
+bool TrajectoryCache::open(const std::string& key, CachedTrajectory& entry) const {
+    uint64_t hash = hashKey(key);
+
+    MappedFile file;
+    if (!file.open(pathFor(hash))) return false;
+
+    // Validate everything before trusting any offset
+    if (file.size() < sizeof(FileHeader)) return false;
+    FileHeader header;
+    std::memcpy(&header, file.data(), sizeof(header));
+
+    if (std::memcmp(header.magic, FILE_MAGIC, sizeof(FILE_MAGIC)) != 0 ||
+        header.version != CACHE_VERSION ||
+        header.encoding > static_cast<uint32_t>(TrajectoryEncoding::Delta16) ||
+        header.keyHash != hash ||
+        header.keySize != key.size() ||
+        header.trajectoryBytes > file.size() ||
+        header.stationCount > file.size() ||
+        header.windowCount > file.size()) {
+        return false;
+    }
+
+    size_t keyOffset = sizeof(FileHeader);
+    size_t trajectoryOffset = align8(keyOffset + header.keySize);
+    size_t countsOffset = trajectoryOffset + header.trajectoryBytes;
+    size_t windowsOffset = countsOffset + header.stationCount * sizeof(uint64_t);
+    size_t endOffset = windowsOffset + header.windowCount * sizeof(WindowRecord);
+
+    if (endOffset != file.size()) return false;
+    if (std::memcmp(file.data() + keyOffset, key.data(), key.size()) != 0) return false;
+
+    // Bound each count by what is left, so the sum can never wrap
+    const uint64_t* counts = reinterpret_cast<const uint64_t*>(file.data() + countsOffset);
+    uint64_t windows = 0;
+    for (uint64_t s = 0; s < header.stationCount; s++) {
+        if (counts[s] > header.windowCount - windows) return false;
+        windows += counts[s];
+    }
+    if (windows != header.windowCount) return false;
+
+    // The trajectory views the mapping and shares ownership of it
+    std::shared_ptr<const MappedFile> mapping = std::make_shared<const MappedFile>(std::move(file));
+    std::shared_ptr<CompactTrajectory> trajectory = std::make_shared<CompactTrajectory>();
+    if (!CompactTrajectory::view(mapping->data() + trajectoryOffset,
+                                 static_cast<size_t>(header.trajectoryBytes), mapping, *trajectory) ||
+        trajectory->size() != header.stateCount ||
+        static_cast<uint32_t>(trajectory->getEncoding()) != header.encoding) {
+        return false;
+    }
+
+    entry.file = std::move(mapping);
+    entry.trajectory = std::move(trajectory);
+    entry.stationCount = static_cast<size_t>(header.stationCount);
+    entry.windowCountsOffset = countsOffset;
+    entry.windowsOffset = windowsOffset;
+    return true;
+}
+
+bool TrajectoryCache::store(
+    const std::string& key,
+    const CompactTrajectory& trajectory,
+    const std::vector<AccessStatistics>& accessStats
+) const {
+    std::error_code error;
+    std::filesystem::create_directories(directory, error);
+    if (error) return false;
+
+    std::string compact;
+    trajectory.serialize(compact);
+
+    FileHeader header;
+    std::memcpy(header.magic, FILE_MAGIC, sizeof(FILE_MAGIC));
+    header.version = CACHE_VERSION;
+    header.encoding = static_cast<uint32_t>(trajectory.getEncoding());
+    header.keyHash = hashKey(key);
+    header.keySize = key.size();
+    header.stateCount = trajectory.size();
+    header.trajectoryBytes = compact.size();
+    header.stationCount = accessStats.size();
+    header.windowCount = 0;
+    for (const auto& stats : accessStats) header.windowCount += stats.windows.size();
+
+    std::string path = pathFor(header.keyHash);
+
+    // Unique temporary name so concurrent writers never share a file
+    static std::atomic<unsigned> tempCounter(0);
+    std::string tempPath = path + ".tmp" + std::to_string(tempCounter.fetch_add(1));
+
+    {
+        std::ofstream file(tempPath, std::ios::binary);
+        if (!file) return false;
+
+        file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        file.write(key.data(), key.size());
+
+        size_t padding = align8(sizeof(header) + key.size()) - (sizeof(header) + key.size());
+        const char zeros[8] = {};
+        file.write(zeros, padding);
+
+        file.write(compact.data(), compact.size());
+
+        for (const auto& stats : accessStats) {
+            uint64_t count = stats.windows.size();
+            file.write(reinterpret_cast<const char*>(&count), sizeof(count));
+        }
+        for (const auto& stats : accessStats) {
+            for (const auto& window : stats.windows) {
+                WindowRecord record = {
+                    window.startTime, window.endTime, window.maxElevation,
+                    window.startFrame, window.endFrame
+                };
+                file.write(reinterpret_cast<const char*>(&record), sizeof(record));
+            }
+        }
+
+        if (!file) {
+            file.close();
+            std::filesystem::remove(tempPath, error);
+            return false;
+        }
+    }
+
+    // Replace any previous entry in one step
+    std::filesystem::rename(tempPath, path, error);
+    if (error) {
+        std::filesystem::remove(tempPath, error);
+        return false;
+    }
+    return true;
+}
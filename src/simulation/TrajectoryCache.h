@@ -0,0 +1,88 @@
+#ifndef TRAJECTORY_CACHE_H
+#define TRAJECTORY_CACHE_H
+
+#include "StateVector.h"
+#include "CompactTrajectory.h"
+#include "ForceModel.h"
+#include "GroundStation.h"
+#include "MappedFile.h"
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+// One cache entry opened in place. The trajectory reads its compact payload
+// straight from the mapped file (zero-copy) and keeps the mapping alive for
+// as long as any handle to it exists; states are decoded on access.
+class CachedTrajectory {
+public:
+    size_t size() const { return trajectory ? trajectory->size() : 0; }
+
+    std::shared_ptr<const CompactTrajectory> getTrajectory() const { return trajectory; }
+
+    // Access windows are small, so they are copied out
+    std::vector<AccessStatistics> accessStatistics() const;
+
+private:
+    friend class TrajectoryCache;
+
+    std::shared_ptr<const MappedFile> file;
+    std::shared_ptr<const CompactTrajectory> trajectory;
+    size_t stationCount = 0;
+    size_t windowCountsOffset = 0;
+    size_t windowsOffset = 0;
+};
+
+/**
+ * On-disk cache of propagated trajectories and their access statistics.
+ *
+ * Each entry is one flat binary file named after a hash of its key. The key
+ * covers everything that affects the result: initial state, span, step,
+ * mu, force-model flags, integrator and the ground station set. The full
+ * key is stored in the file too, so a hash collision is a miss rather than
+ * wrong data. Files are written to a temporary name and renamed, so a
+ * crash never leaves a half-written entry behind.
+ *
+ * Trajectories are stored as the CompactTrajectory image the caller encoded
+ * (Delta16 by default, about a quarter of the dense size), so an opened
+ * entry is used from the mapping without being decoded or copied. Decoded
+ * states differ from the propagated ones by at most the container's exact
+ * error bound (at most ~0.1 m on the presets); access windows are computed
+ * from the dense trajectory before encoding and stored as-is.
+ *
+ * Bump CACHE_VERSION whenever propagation or access code changes results.
+ */
+class TrajectoryCache {
+public:
+    static constexpr uint32_t CACHE_VERSION = 2;
+
+    explicit TrajectoryCache(const std::string& directory);
+
+    static std::string makeKey(
+        const StateVector& initialState,
+        double duration,
+        double timestep,
+        double mu,
+        const ForceModel& forceModel,
+        const std::string& integratorName,
+        const std::vector<GroundStation>& groundStations
+    );
+
+    // Map an entry; false on a miss or a stale/corrupt file
+    bool open(const std::string& key, CachedTrajectory& entry) const;
+
+    bool store(
+        const std::string& key,
+        const CompactTrajectory& trajectory,
+        const std::vector<AccessStatistics>& accessStats
+    ) const;
+
+    const std::string& getDirectory() const { return directory; }
+
+private:
+    std::string directory;
+
+    std::string pathFor(uint64_t hash) const;
+};
+
+#endif // TRAJECTORY_CACHE_H
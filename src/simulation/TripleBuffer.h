@@ -0,0 +1,63 @@
+#ifndef TRIPLE_BUFFER_H
+#define TRIPLE_BUFFER_H
+
+#include <atomic>
+#include <cstdint>
+
+/**
+ * Lock-free single-producer / single-consumer triple buffer.
+ *
+ * The writer fills writeBuffer() and calls publish(); the reader calls
+ * update() and then reads readBuffer(). Neither side ever blocks: the
+ * writer always has a private buffer to fill and the reader always sees
+ * the most recently published complete value. Intermediate values the
+ * reader did not pick up in time are simply overwritten.
+ */
+template <typename T>
+class TripleBuffer {
+public:
+    TripleBuffer() : middle(1), backIndex(0), frontIndex(2) {}
+
+    TripleBuffer(const TripleBuffer&) = delete;
+    TripleBuffer& operator=(const TripleBuffer&) = delete;
+
+    // Writer side: buffer owned exclusively by the producer
+    T& writeBuffer() { return buffers[backIndex]; }
+
+    // Writer side: hand the filled buffer over to the reader
+    void publish() {
+        uint8_t previous = middle.exchange(
+            static_cast<uint8_t>(backIndex | NEW_DATA_BIT),
+            std::memory_order_acq_rel
+        );
+        backIndex = previous & INDEX_MASK;
+    }
+
+    // Reader side: swap in the newest published buffer (if any).
+    // Returns true when readBuffer() changed.
+    bool update() {
+        if ((middle.load(std::memory_order_relaxed) & NEW_DATA_BIT) == 0) {
+            return false;
+        }
+        uint8_t previous = middle.exchange(frontIndex, std::memory_order_acq_rel);
+        frontIndex = previous & INDEX_MASK;
+        return true;
+    }
+
+    // Reader side: buffer owned exclusively by the consumer
+    const T& readBuffer() const { return buffers[frontIndex]; }
+
+private:
+    static constexpr uint8_t INDEX_MASK = 0x03;
+    static constexpr uint8_t NEW_DATA_BIT = 0x04;
+
+    T buffers[3];
+
+    // Index of the shared buffer, plus NEW_DATA_BIT when it holds unread data
+    alignas(64) std::atomic<uint8_t> middle;
+
+    alignas(64) uint8_t backIndex;   // Writer-owned
+    alignas(64) uint8_t frontIndex;  // Reader-owned
+};
+
+#endif // TRIPLE_BUFFER_H
@@ -0,0 +1,79 @@
+#include "CachedPanel.h"
+#include "Constants.h"
+#include "rlgl.h"
+
+CachedPanel::CachedPanel()
+    : target{}, width(0), height(0), layoutKey(0), valueKey(0), lastRedraw(0.0),
+      loaded(false), valid(false) {}
+
+CachedPanel::~CachedPanel() {
+    unload();
+}
+
+bool CachedPanel::needsRedraw(int newWidth, int newHeight, uint64_t newLayoutKey, uint64_t newValueKey) {
+    if (newWidth <= 0 || newHeight <= 0) return false;
+
+    if (!loaded || newWidth != width || newHeight != height) {
+        unload();
+        target = LoadRenderTexture(newWidth, newHeight);
+        width = newWidth;
+        height = newHeight;
+        loaded = true;
+    }
+
+    double now = GetTime();
+    bool stale = !valid || newLayoutKey != layoutKey ||
+                 (newValueKey != valueKey && now - lastRedraw >= UI_VALUE_REFRESH_INTERVAL);
+    if (!stale) return false;
+
+    layoutKey = newLayoutKey;
+    valueKey = newValueKey;
+    lastRedraw = now;
+    valid = true;
+    return true;
+}
+
+void CachedPanel::beginRedraw() {
+    BeginTextureMode(target);
+    ClearBackground(BLANK);
+
+    // Colour is blended as usual but stored premultiplied; alpha accumulates
+    // as coverage so translucent layers are not darkened twice
+    rlSetBlendFactorsSeparate(RL_SRC_ALPHA, RL_ONE_MINUS_SRC_ALPHA, RL_ONE, RL_ONE_MINUS_SRC_ALPHA,
+                              RL_FUNC_ADD, RL_FUNC_ADD);
+    BeginBlendMode(BLEND_CUSTOM_SEPARATE);
+}
+
+void CachedPanel::endRedraw() {
+    EndBlendMode();
+    EndTextureMode();
+}
+
+void CachedPanel::draw(int x, int y) const {
+    draw(x, y, 0, height);
+}
+
+void CachedPanel::draw(int x, int y, int sourceY, int rows) const {
+    if (!loaded) return;
+
+    if (sourceY < 0) sourceY = 0;
+    if (sourceY + rows > height) rows = height - sourceY;
+    if (rows <= 0) return;
+
+    // Render textures are stored bottom-up; a negative height flips them
+    Rectangle source{0.0f, (float)(height - sourceY - rows), (float)width, -(float)rows};
+    BeginBlendMode(BLEND_ALPHA_PREMULTIPLY);
+    DrawTextureRec(target.texture, source, Vector2{(float)x, (float)y}, WHITE);
+    EndBlendMode();
+}
+
+void CachedPanel::unload() {
+    if (!loaded) return;
+
+    UnloadRenderTexture(target);
+    target = RenderTexture2D{};
+    width = 0;
+    height = 0;
+    loaded = false;
+    valid = false;
+}
@@ -0,0 +1,79 @@
+#ifndef CACHED_PANEL_H
+#define CACHED_PANEL_H
+
+#include "raylib.h"
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+// FNV-1a hash of a panel's inputs
+class PanelKey {
+public:
+    PanelKey() : hash(14695981039346656037ull) {}
+
+    PanelKey& add(const void* data, size_t size) {
+        const unsigned char* bytes = static_cast<const unsigned char*>(data);
+        for (size_t i = 0; i < size; i++) {
+            hash = (hash ^ bytes[i]) * 1099511628211ull;
+        }
+        return *this;
+    }
+    PanelKey& add(double value) { return add(&value, sizeof(value)); }
+    PanelKey& add(size_t value) { return add(&value, sizeof(value)); }
+    PanelKey& add(int value) { return add(&value, sizeof(value)); }
+    PanelKey& add(bool value) { return add(&value, sizeof(value)); }
+    PanelKey& add(const std::string& value) { return add(value.data(), value.size()).add(value.size()); }
+
+    uint64_t value() const { return hash; }
+
+private:
+    uint64_t hash;
+};
+
+/**
+ * Retained UI panel: content is rendered once into a RenderTexture and
+ * composited every frame.
+ *
+ * The content is re-rendered when its layout key changes (toggles, active
+ * satellite, ...) and, at most every UI_VALUE_REFRESH_INTERVAL, when its
+ * value key changes (live numbers). The texture holds premultiplied alpha,
+ * so translucent content composites exactly as if drawn directly.
+ */
+class CachedPanel {
+public:
+    CachedPanel();
+    ~CachedPanel();
+
+    // True when the content must be re-rendered this frame; (re)allocates
+    // the texture when the size changes
+    bool needsRedraw(int width, int height, uint64_t layoutKey, uint64_t valueKey = 0);
+
+    // Redirect drawing into the panel (origin at its top-left corner)
+    void beginRedraw();
+    void endRedraw();
+
+    void draw(int x, int y) const;
+
+    // Draw rows [sourceY, sourceY + rows) of the panel at (x, y)
+    void draw(int x, int y, int sourceY, int rows) const;
+
+    // Force a redraw on the next needsRedraw()
+    void invalidate() { valid = false; }
+
+    void unload();
+
+    int getWidth() const { return width; }
+    int getHeight() const { return height; }
+
+private:
+    RenderTexture2D target;
+    int width;
+    int height;
+    uint64_t layoutKey;
+    uint64_t valueKey;
+    double lastRedraw;
+    bool loaded;
+    bool valid;
+};
+
+#endif // CACHED_PANEL_H
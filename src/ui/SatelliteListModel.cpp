@@ -0,0 +1,86 @@
+#include "SatelliteListModel.h"
+#include <algorithm>
+#include <cstdint>
+
+SatelliteListModel::SatelliteListModel()
+    : indexedCount(0), searching(false), familyMask(ALL_FAMILIES), firstRow(0), rowsStale(true) {}
+
+void SatelliteListModel::refresh(const std::vector<Satellite>& satellites) {
+    if (satellites.size() != indexedCount) {
+        std::vector<std::string> names(satellites.size());
+        for (size_t i = 0; i < satellites.size(); i++) {
+            names[i] = satellites[i].getPreset().name;
+        }
+        index.build(names);
+        indexedCount = satellites.size();
+        rowsStale = true;
+    }
+    if (!rowsStale) return;
+
+    const std::vector<uint32_t>& matches = index.search(query);
+    if (familyMask == ALL_FAMILIES) {
+        rows = matches;
+    } else {
+        rows.clear();
+        for (uint32_t i : matches) {
+            if (familyMask & familyBit(satellites[i].getStats().family)) rows.push_back(i);
+        }
+    }
+
+    clampFirstRow();
+    rowsStale = false;
+}
+
+void SatelliteListModel::appendToQuery(char c) {
+    query.push_back(c);
+    firstRow = 0;
+    rowsStale = true;
+}
+
+void SatelliteListModel::eraseFromQuery() {
+    if (query.empty()) return;
+    query.pop_back();
+    firstRow = 0;
+    rowsStale = true;
+}
+
+void SatelliteListModel::toggleFamily(OrbitFamily family) {
+    familyMask ^= familyBit(family);
+    firstRow = 0;
+    rowsStale = true;
+}
+
+size_t SatelliteListModel::getVisibleRowCount() const {
+    return std::min(VISIBLE_ROWS, rows.size() - firstRow);
+}
+
+size_t SatelliteListModel::satelliteAtRow(size_t row) const {
+    if (row >= getVisibleRowCount()) return SIZE_MAX;
+    return rows[firstRow + row];
+}
+
+void SatelliteListModel::scroll(int rowDelta) {
+    if (rowDelta < 0 && (size_t)(-rowDelta) > firstRow) {
+        firstRow = 0;
+    } else {
+        firstRow += rowDelta;
+    }
+    clampFirstRow();
+}
+
+void SatelliteListModel::scrollTo(size_t satelliteIndex) {
+    auto it = std::find(rows.begin(), rows.end(), (uint32_t)satelliteIndex);
+    if (it == rows.end()) return;
+
+    size_t row = it - rows.begin();
+    if (row < firstRow) {
+        firstRow = row;
+    } else if (row >= firstRow + VISIBLE_ROWS) {
+        firstRow = row + 1 - VISIBLE_ROWS;
+    }
+}
+
+void SatelliteListModel::clampFirstRow() {
+    size_t maxFirst = rows.size() > VISIBLE_ROWS ? rows.size() - VISIBLE_ROWS : 0;
+    firstRow = std::min(firstRow, maxFirst);
+}
@@ -0,0 +1,76 @@
+#ifndef SATELLITE_LIST_MODEL_H
+#define SATELLITE_LIST_MODEL_H
+
+#include "Satellite.h"
+#include "FuzzyNameIndex.h"
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/**
+ * State behind the satellite list: name search, orbit family filter and
+ * the scrolled window of rows.
+ *
+ * Rows are the satellite indices passing the search and filter. They are
+ * only recomputed when the query, the filter or the catalog changes, and
+ * the list draws just the VISIBLE_ROWS window, so the per-frame cost does
+ * not grow with the catalog.
+ */
+class SatelliteListModel {
+public:
+    static constexpr size_t VISIBLE_ROWS = 12;
+
+    SatelliteListModel();
+
+    // Re-index when the catalog size changed and recompute stale rows
+    void refresh(const std::vector<Satellite>& satellites);
+
+    // Families may have changed (e.g. after re-propagation)
+    void invalidate() { rowsStale = true; }
+
+    // Search box
+    void beginSearch() { searching = true; }
+    void endSearch() { searching = false; }
+    bool isSearching() const { return searching; }
+    void appendToQuery(char c);
+    void eraseFromQuery();
+    const std::string& getQuery() const { return query; }
+
+    // Orbit family filter
+    void toggleFamily(OrbitFamily family);
+    bool isFamilyShown(OrbitFamily family) const { return (familyMask & familyBit(family)) != 0; }
+
+    // Listed satellite indices, in display order
+    const std::vector<uint32_t>& getRows() const { return rows; }
+    size_t getFirstRow() const { return firstRow; }
+    size_t getVisibleRowCount() const;
+
+    // Satellite in on-screen row `row` (0 = top of the window), or SIZE_MAX
+    size_t satelliteAtRow(size_t row) const;
+
+    void scroll(int rowDelta);
+
+    // Scroll so a listed satellite is inside the window
+    void scrollTo(size_t satelliteIndex);
+
+private:
+    static constexpr uint8_t ALL_FAMILIES = 0x0F;
+
+    FuzzyNameIndex index;
+    size_t indexedCount;
+
+    std::string query;
+    bool searching;
+    uint8_t familyMask;
+
+    std::vector<uint32_t> rows;
+    size_t firstRow;
+    bool rowsStale;
+
+    static uint8_t familyBit(OrbitFamily family) { return static_cast<uint8_t>(1u << static_cast<int>(family)); }
+
+    void clampFirstRow();
+};
+
+#endif // SATELLITE_LIST_MODEL_H
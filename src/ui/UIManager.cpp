@@ -4,16 +4,31 @@
 #include "Constants.h"
 #include "GroundStation.h"
 #include "ForceModel.h"
+#include "Palette.h"
+#include "Profiler.h"
+#include <algorithm>
 #include <cstdio>
 #include <cmath>
 
 UIManager::UIManager(int width, int height)
     : screenWidth(width), screenHeight(height),
       showLeftSidebar(true), showRightSidebar(true), showHelp(false),
-      showEclipse(true), showSolar(true), showGroundStations(true),
+      showEclipse(true), showSolar(true), showGroundStations(true), showProfiler(false),
+      propagationCompleted(0), propagationTotal(0),
       leftSidebarOffset(0.0f), rightSidebarOffset(0.0f),
       targetLeftOffset(0.0f), targetRightOffset(0.0f),
-      leftSidebarScroll(0.0f), leftSidebarContentHeight(0.0f) {}
+      leftSidebarScroll(0.0f), leftSidebarContentHeight(0.0f),
+      listedActiveIndex(SIZE_MAX), satelliteRowsY(0) {}
+
+void UIManager::unload()
+{
+    titlePanel.unload();
+    statusPanel.unload();
+    leftContentPanel.unload();
+    rightPanel.unload();
+    legendPanel.unload();
+    profilerPanel.unload();
+}
 
 void UIManager::update(float deltaTime)
 {
@@ -79,12 +94,45 @@ void UIManager::draw(
     const std::vector<AccessStatistics> &accessStats,
     const ForceModel &forceModel)
 {
-    drawTitleBar(fonts);
+    satelliteList.refresh(satellites);
+    if (activeSatIndex != listedActiveIndex)
+    {
+        satelliteList.scrollTo(activeSatIndex);
+        listedActiveIndex = activeSatIndex;
+    }
+
+    // Panels are drawn from cached textures; the one-pixel margins keep the
+    // 2 px border lines whole
+    uint64_t titleKey = PanelKey().add(showEclipse).add(showSolar).value();
+    if (titlePanel.needsRedraw(screenWidth, UITheme::TITLE_BAR_HEIGHT + 1, titleKey))
+    {
+        titlePanel.beginRedraw();
+        drawTitleBar(fonts);
+        titlePanel.endRedraw();
+    }
+    titlePanel.draw(0, 0);
 
     if (activeSatIndex < satellites.size())
     {
-        drawStatusBar(fonts, satellites[activeSatIndex], animationSpeed,
-                      showGrids, earthRotation, cameraFollow, fps);
+        const Satellite &activeSat = satellites[activeSatIndex];
+
+        uint64_t statusKey = PanelKey()
+                                 .add(activeSatIndex)
+                                 .add(activeSat.getStats().orbitFamily)
+                                 .add(animationSpeed)
+                                 .add(showGrids)
+                                 .add(earthRotation)
+                                 .add(cameraFollow)
+                                 .value();
+        if (statusPanel.needsRedraw(screenWidth, UITheme::STATUS_BAR_HEIGHT + 1, statusKey,
+                                    PanelKey().add(fps).value()))
+        {
+            statusPanel.beginRedraw();
+            drawStatusBar(fonts, activeSat, animationSpeed,
+                          showGrids, earthRotation, cameraFollow, fps);
+            statusPanel.endRedraw();
+        }
+        statusPanel.draw(0, screenHeight - UITheme::STATUS_BAR_HEIGHT - 1);
 
         // Draw sidebars with animation offset
         if (leftSidebarOffset > -(float)UITheme::SIDEBAR_WIDTH + 10.0f)
@@ -95,13 +143,51 @@ void UIManager::draw(
 
         if (rightSidebarOffset < (float)UITheme::SIDEBAR_WIDTH - 10.0f)
         {
-            drawRightSidebar(fonts, satellites[activeSatIndex], currentElements, sunDirection);
+            const StateVector &state = activeSat.getCurrentState();
+            const OrbitStatistics &stats = activeSat.getStats();
+
+            uint64_t layoutKey = PanelKey().add(activeSatIndex).add(stats.orbitFamily).add(showEclipse).value();
+            uint64_t valueKey = PanelKey()
+                                    .add(currentElements.semiMajorAxis)
+                                    .add(currentElements.eccentricity)
+                                    .add(currentElements.inclination)
+                                    .add(currentElements.rightAscension)
+                                    .add(currentElements.argumentOfPeriapsis)
+                                    .add(currentElements.trueAnomaly)
+                                    .add(currentElements.period)
+                                    .add(state.position.x).add(state.position.y).add(state.position.z)
+                                    .add(state.velocity.x).add(state.velocity.y).add(state.velocity.z)
+                                    .add(sunDirection.x).add(sunDirection.y).add(sunDirection.z)
+                                    .add(stats.periapsisAlt).add(stats.apoapsisAlt).add(stats.meanAltitude)
+                                    .add(stats.periapsisVel).add(stats.apoapsisVel)
+                                    .value();
+            if (rightPanel.needsRedraw(getRightSidebarWidth(), getRightSidebarHeight(), layoutKey, valueKey))
+            {
+                rightPanel.beginRedraw();
+                drawRightSidebar(fonts, activeSat, currentElements, sunDirection);
+                rightPanel.endRedraw();
+            }
+            rightPanel.draw(getRightSidebarX() + (int)rightSidebarOffset, getRightSidebarY());
         }
     }
 
+    if (showProfiler)
+    {
+        drawProfilerOverlay(fonts);
+    }
+
     if (showHelp)
     {
-        drawKeyboardLegend(fonts);
+        // Semi-transparent dark overlay
+        DrawRectangle(0, 0, screenWidth, screenHeight, Fade(BLACK, 0.7f));
+
+        if (legendPanel.needsRedraw(LEGEND_WIDTH, LEGEND_HEIGHT, 0))
+        {
+            legendPanel.beginRedraw();
+            drawKeyboardLegend(fonts);
+            legendPanel.endRedraw();
+        }
+        legendPanel.draw((screenWidth - LEGEND_WIDTH) / 2, (screenHeight - LEGEND_HEIGHT) / 2);
     }
 }
 
@@ -158,7 +244,8 @@ void UIManager::drawStatusBar(
     bool cameraFollow,
     int fps)
 {
-    int yPos = screenHeight - UITheme::STATUS_BAR_HEIGHT;
+    // Drawn into its cached panel, one pixel below the top for the border line
+    int yPos = 1;
 
     // Background
     DrawRectangle(0, yPos, screenWidth, UITheme::STATUS_BAR_HEIGHT, UITheme::BG_PANEL);
@@ -190,13 +277,13 @@ void UIManager::drawStatusBar(
     // Active satellite
     snprintf(buffer, sizeof(buffer), "%s", activeSat.getPreset().name.c_str());
     fonts.drawText(buffer, xPos, yText, UITheme::FONT_SIZE_BODY,
-                   activeSat.getStats().familyColor, true);
+                   Palette::familyColor(activeSat.getStats().family), true);
     xPos += 80;
 
     // Orbit family badge
     snprintf(buffer, sizeof(buffer), "[%s]", activeSat.getStats().orbitFamily.c_str());
     fonts.drawText(buffer, xPos, yText, UITheme::FONT_SIZE_BODY,
-                   activeSat.getStats().familyColor);
+                   Palette::familyColor(activeSat.getStats().family));
     xPos += 70;
 
     // Separator
@@ -253,9 +340,15 @@ void UIManager::drawLeftSidebar(
     int height = getLeftSidebarHeight();
 
     // Handle mouse wheel scrolling when mouse is over sidebar
+    // (over the satellite rows it scrolls the list instead)
     Vector2 mousePos = GetMousePosition();
-    if (mousePos.x >= x && mousePos.x <= x + width &&
-        mousePos.y >= y && mousePos.y <= y + height)
+    size_t hoveredSatellite;
+    if (satelliteAt(mousePos, hoveredSatellite))
+    {
+        satelliteList.scroll((int)(-GetMouseWheelMove() * 3.0f));
+    }
+    else if (mousePos.x >= x && mousePos.x <= x + width &&
+             mousePos.y >= y && mousePos.y <= y + height)
     {
         float wheel = GetMouseWheelMove();
         leftSidebarScroll -= wheel * 40.0f; // Scroll speed
@@ -273,11 +366,95 @@ void UIManager::drawLeftSidebar(
     // Main panel background
     UITheme::DrawPanel(x, y, width, height, UITheme::BORDER_ACCENT);
 
-    // Enable scissor mode (clipping) for scrollable content
-    BeginScissorMode(x, y, width, height);
+    // Content is cached unscrolled at full height; scrolling picks the window
+    PanelKey layout;
+    layout.add(activeSatIndex).add(showSolar).add(showGroundStations).add(forceModel.j2Perturbation);
+    layout.add(propagationCompleted).add(propagationTotal);
+    layout.add(satellites.size()).add(satelliteList.getRows().size()).add(satelliteList.getFirstRow());
+    layout.add(satelliteList.getQuery()).add(satelliteList.isSearching());
+    for (OrbitFamily family : {OrbitFamily::LEO, OrbitFamily::MEO, OrbitFamily::HEO, OrbitFamily::GEO})
+    {
+        layout.add(satelliteList.isFamilyShown(family));
+    }
+    for (size_t row = 0; row < satelliteList.getVisibleRowCount(); row++)
+    {
+        const Satellite &sat = satellites[satelliteList.satelliteAtRow(row)];
+        layout.add(satelliteList.satelliteAtRow(row)).add(sat.isVisible()).add(sat.getStats().orbitFamily);
+    }
+    for (const auto &station : groundStations)
+    {
+        layout.add(station.visible);
+    }
+    for (const auto &stats : accessStats)
+    {
+        layout.add(stats.passesPerOrbit).add(stats.totalAccessTime)
+            .add(stats.averagePassDuration).add(stats.longestPass);
+    }
 
-    int contentX = x + UITheme::PANEL_PADDING;
-    int contentY = y + UITheme::PANEL_PADDING - (int)leftSidebarScroll; // Apply scroll
+    // Only the solar analysis shows live numbers
+    PanelKey values;
+    if (showSolar && activeSatIndex < satellites.size())
+    {
+        const StateVector &state = satellites[activeSatIndex].getCurrentState();
+        values.add(state.position.x).add(state.position.y).add(state.position.z)
+            .add(state.velocity.x).add(state.velocity.y).add(state.velocity.z)
+            .add(sunDirection.x).add(sunDirection.y).add(sunDirection.z);
+    }
+
+    int contentHeight = height + (int)std::max(0.0f, leftSidebarContentHeight - height + 40.0f);
+    if (leftContentPanel.needsRedraw(width, contentHeight, layout.value(), values.value()))
+    {
+        leftContentPanel.beginRedraw();
+        drawLeftSidebarContent(fonts, satellites, activeSatIndex, sunDirection,
+                               groundStations, accessStats, forceModel, width);
+        leftContentPanel.endRedraw();
+
+        // Content outgrew the texture: render again at the new size next frame
+        int neededHeight = height + (int)std::max(0.0f, leftSidebarContentHeight - height + 40.0f);
+        if (neededHeight > contentHeight)
+        {
+            leftContentPanel.invalidate();
+        }
+    }
+    leftContentPanel.draw(x, y, (int)leftSidebarScroll, height);
+
+    // Draw scrollbar if content is scrollable
+    float maxScroll = leftSidebarContentHeight - height + 40.0f;
+    if (maxScroll > 0)
+    {
+        int scrollbarWidth = 6;
+        int scrollbarX = x + width - scrollbarWidth - 4;
+        int scrollbarY = y + 4;
+        int scrollbarHeight = height - 8;
+
+        // Scrollbar background
+        DrawRectangle(scrollbarX, scrollbarY, scrollbarWidth, scrollbarHeight,
+                      Fade(UITheme::BORDER, 0.3f));
+
+        // Scrollbar thumb
+        float thumbHeight = (height / leftSidebarContentHeight) * scrollbarHeight;
+        if (thumbHeight < 30)
+            thumbHeight = 30; // Minimum thumb size
+        float thumbY = scrollbarY + (leftSidebarScroll / maxScroll) * (scrollbarHeight - thumbHeight);
+
+        DrawRectangle(scrollbarX, (int)thumbY, scrollbarWidth, (int)thumbHeight,
+                      UITheme::ACCENT);
+    }
+}
+
+void UIManager::drawLeftSidebarContent(
+    const FontSystem &fonts,
+    const std::vector<Satellite> &satellites,
+    size_t activeSatIndex,
+    const Vector3D &sunDirection,
+    const std::vector<GroundStation> &groundStations,
+    const std::vector<AccessStatistics> &accessStats,
+    const ForceModel &forceModel,
+    int width)
+{
+    // Drawn at the origin of the cached content panel
+    int contentX = UITheme::PANEL_PADDING;
+    int contentY = UITheme::PANEL_PADDING;
     int contentWidth = width - (UITheme::PANEL_PADDING * 2);
     int yOffset = contentY;
 
@@ -311,40 +488,12 @@ void UIManager::drawLeftSidebar(
                               groundStations, accessStats,
                               contentX, yOffset, contentWidth, yOffset);
         }
-
-        
     }
 
     drawForceModelPanel(fonts, forceModel, contentX, yOffset, contentWidth, yOffset);
 
-    
     // Store total content height
     leftSidebarContentHeight = (yOffset - contentY) + UITheme::PANEL_PADDING;
-
-    EndScissorMode();
-
-    // Draw scrollbar if content is scrollable
-    float maxScroll = leftSidebarContentHeight - height + 40.0f;
-    if (maxScroll > 0)
-    {
-        int scrollbarWidth = 6;
-        int scrollbarX = x + width - scrollbarWidth - 4;
-        int scrollbarY = y + 4;
-        int scrollbarHeight = height - 8;
-
-        // Scrollbar background
-        DrawRectangle(scrollbarX, scrollbarY, scrollbarWidth, scrollbarHeight,
-                      Fade(UITheme::BORDER, 0.3f));
-
-        // Scrollbar thumb
-        float thumbHeight = (height / leftSidebarContentHeight) * scrollbarHeight;
-        if (thumbHeight < 30)
-            thumbHeight = 30; // Minimum thumb size
-        float thumbY = scrollbarY + (leftSidebarScroll / maxScroll) * (scrollbarHeight - thumbHeight);
-
-        DrawRectangle(scrollbarX, (int)thumbY, scrollbarWidth, (int)thumbHeight,
-                      UITheme::ACCENT);
-    }
 }
 
 void UIManager::drawSatelliteList(
@@ -357,16 +506,53 @@ void UIManager::drawSatelliteList(
 
     // Section header
     fonts.drawText("SATELLITES", x, yOffset, UITheme::FONT_SIZE_H2, UITheme::SECONDARY, true);
+
+    const std::vector<uint32_t> &rows = satelliteList.getRows();
+    char buffer[128];
+    snprintf(buffer, sizeof(buffer), "%zu / %zu", rows.size(), satellites.size());
+    fonts.drawText(buffer, x + width - 90, yOffset + 4, UITheme::FONT_SIZE_SMALL, UITheme::TEXT_MUTED);
     yOffset += 28;
 
     // Divider
     UITheme::DrawDivider(x, yOffset, width);
     yOffset += UITheme::SPACING_MD;
 
-    // Satellite list
-    for (size_t i = 0; i < satellites.size(); i++)
+    // Search box
+    int boxHeight = 22;
+    DrawRectangle(x, yOffset, width, boxHeight, UITheme::BG_DARK);
+    DrawRectangleLines(x, yOffset, width, boxHeight,
+                       satelliteList.isSearching() ? UITheme::ACCENT : UITheme::BORDER);
+    if (satelliteList.isSearching() || !satelliteList.getQuery().empty())
+    {
+        snprintf(buffer, sizeof(buffer), "%s%s", satelliteList.getQuery().c_str(),
+                 satelliteList.isSearching() ? "_" : "");
+        fonts.drawText(buffer, x + UITheme::SPACING_SM, yOffset + 4, UITheme::FONT_SIZE_BODY,
+                       UITheme::TEXT_PRIMARY);
+    }
+    else
     {
-        Color textColor = satellites[i].isVisible() ? satellites[i].getStats().familyColor : UITheme::TEXT_MUTED;
+        fonts.drawText("Press / to search", x + UITheme::SPACING_SM, yOffset + 5,
+                       UITheme::FONT_SIZE_SMALL, UITheme::TEXT_MUTED);
+    }
+    yOffset += boxHeight + UITheme::SPACING_SM;
+
+    // Family filter (F5-F8)
+    const OrbitFamily families[] = {OrbitFamily::LEO, OrbitFamily::MEO, OrbitFamily::HEO, OrbitFamily::GEO};
+    const char *familyNames[] = {"LEO", "MEO", "HEO", "GEO"};
+    for (int f = 0; f < 4; f++)
+    {
+        bool shown = satelliteList.isFamilyShown(families[f]);
+        fonts.drawText(familyNames[f], x + f * 50, yOffset, UITheme::FONT_SIZE_SMALL,
+                       shown ? Palette::familyColor(families[f]) : UITheme::TEXT_MUTED, shown);
+    }
+    yOffset += 18 + UITheme::SPACING_SM;
+
+    // Only the rows inside the scrolled window are laid out
+    satelliteRowsY = yOffset;
+    for (size_t row = 0; row < satelliteList.getVisibleRowCount(); row++)
+    {
+        size_t i = satelliteList.satelliteAtRow(row);
+        Color textColor = satellites[i].isVisible() ? Palette::familyColor(satellites[i].getStats().family) : UITheme::TEXT_MUTED;
 
         const char *activeMarker = (i == activeSatIndex) ? "> " : "  ";
 
@@ -383,7 +569,22 @@ void UIManager::drawSatelliteList(
                  satellites[i].getStats().orbitFamily.c_str());
         fonts.drawText(satText, x + 140, yOffset, UITheme::FONT_SIZE_SMALL, textColor);
 
-        yOffset += 24;
+        yOffset += SATELLITE_ROW_HEIGHT;
+    }
+
+    if (rows.empty())
+    {
+        fonts.drawText("No matching satellites", x, yOffset, UITheme::FONT_SIZE_SMALL, UITheme::TEXT_MUTED);
+        yOffset += SATELLITE_ROW_HEIGHT;
+    }
+    else if (rows.size() > SatelliteListModel::VISIBLE_ROWS)
+    {
+        snprintf(buffer, sizeof(buffer), "Rows %zu-%zu of %zu (wheel / PgUp / PgDn)",
+                 satelliteList.getFirstRow() + 1,
+                 satelliteList.getFirstRow() + satelliteList.getVisibleRowCount(),
+                 rows.size());
+        fonts.drawText(buffer, x, yOffset, UITheme::FONT_SIZE_SMALL, UITheme::TEXT_MUTED);
+        yOffset += 18;
     }
 }
 
@@ -458,7 +659,7 @@ void UIManager::drawSolarAnalysis(
 
     snprintf(buffer, sizeof(buffer), "%s", solar.getPowerStatus());
     fonts.drawText(buffer, x + UITheme::SPACING_SM, yOffset, UITheme::FONT_SIZE_BODY,
-                   solar.getEfficiencyColor(), true);
+                   Palette::solarEfficiencyColor(solar.solarEfficiency), true);
     yOffset += 26;
 
     // Solar efficiency
@@ -468,7 +669,7 @@ void UIManager::drawSolarAnalysis(
 
     snprintf(buffer, sizeof(buffer), "%.1f%%", solar.solarEfficiency * 100.0);
     fonts.drawText(buffer, x + UITheme::SPACING_SM, yOffset, UITheme::FONT_SIZE_H3,
-                   solar.getEfficiencyColor(), true);
+                   Palette::solarEfficiencyColor(solar.solarEfficiency), true);
     yOffset += 26;
 
     // Efficiency bar
@@ -477,7 +678,7 @@ void UIManager::drawSolarAnalysis(
 
     DrawRectangle(x, yOffset, barWidth, barHeight, UITheme::BG_DARK);
     DrawRectangle(x, yOffset, (int)(barWidth * solar.solarEfficiency), barHeight,
-                  solar.getEfficiencyColor());
+                  Palette::solarEfficiencyColor(solar.solarEfficiency));
     DrawRectangleLines(x, yOffset, barWidth, barHeight, UITheme::BORDER);
     yOffset += barHeight + UITheme::SPACING_LG;
 
@@ -543,13 +744,13 @@ void UIManager::drawGroundStations(
             continue;
 
         fonts.drawText(station.name.c_str(), x, yOffset, UITheme::FONT_SIZE_BODY,
-                       station.color, true);
+                       Palette::stationColor(station), true);
 
         // Station code badge
         char codeText[32];
         snprintf(codeText, sizeof(codeText), "[%s]", station.code.c_str());
         fonts.drawText(codeText, x + 140, yOffset, UITheme::FONT_SIZE_SMALL,
-                       station.color);
+                       Palette::stationColor(station));
         yOffset += 20;
 
         // Location
@@ -598,7 +799,7 @@ void UIManager::drawAccessWindows(
 
         // Station name
         fonts.drawText(station.name.c_str(), x, yOffset, UITheme::FONT_SIZE_BODY,
-                       station.color, true);
+                       Palette::stationColor(station), true);
         yOffset += 20;
 
         char buffer[256];
@@ -705,6 +906,15 @@ void UIManager::drawForceModelPanel(
                    UITheme::TEXT_MUTED);
     yOffset += 18;
 
+    if (propagationCompleted < propagationTotal)
+    {
+        char buffer[64];
+        snprintf(buffer, sizeof(buffer), "Re-propagating orbits... %zu/%zu",
+                 propagationCompleted, propagationTotal);
+        fonts.drawText(buffer, x, yOffset, UITheme::FONT_SIZE_SMALL, UITheme::INFO);
+        yOffset += 18;
+    }
+
     if (forceModel.j2Perturbation)
     {
         fonts.drawText("Orbit precession active", x, yOffset, UITheme::FONT_SIZE_SMALL,
@@ -718,13 +928,14 @@ void UIManager::drawRightSidebar(
     const OrbitalElements &elements,
     const Vector3D &sunDirection)
 {
-    int x = getRightSidebarX() + (int)rightSidebarOffset;
-    int y = getRightSidebarY();
+    // Drawn at the origin of its cached panel
+    int x = 0;
+    int y = 0;
     int width = getRightSidebarWidth();
     int height = getRightSidebarHeight();
 
     // Main panel background
-    UITheme::DrawPanel(x, y, width, height, activeSat.getStats().familyColor);
+    UITheme::DrawPanel(x, y, width, height, Palette::familyColor(activeSat.getStats().family));
 
     int contentX = x + UITheme::PANEL_PADDING;
     int contentY = y + UITheme::PANEL_PADDING;
@@ -745,7 +956,7 @@ void UIManager::drawOrbitalElements(
 
     // Header
     fonts.drawText("ORBITAL ELEMENTS", x, yOffset, UITheme::FONT_SIZE_H1,
-                   activeSat.getStats().familyColor, true);
+                   Palette::familyColor(activeSat.getStats().family), true);
     yOffset += 30;
 
     // Description
@@ -756,7 +967,7 @@ void UIManager::drawOrbitalElements(
     // Orbit family badge
     int badgeWidth = 90;
     int badgeHeight = 26;
-    DrawRectangle(x, yOffset, badgeWidth, badgeHeight, activeSat.getStats().familyColor);
+    DrawRectangle(x, yOffset, badgeWidth, badgeHeight, Palette::familyColor(activeSat.getStats().family));
     fonts.drawText(activeSat.getStats().orbitFamily.c_str(),
                    x + 10, yOffset + 5, UITheme::FONT_SIZE_BODY, BLACK, true);
     yOffset += badgeHeight + UITheme::SPACING_LG;
@@ -916,14 +1127,11 @@ void UIManager::drawOrbitalElements(
 
 void UIManager::drawKeyboardLegend(const FontSystem &fonts)
 {
-    // Smaller help panel - positioned in center but more compact
-    int panelW = 580;
-    int panelH = 540;
-    int panelX = (screenWidth - panelW) / 2;
-    int panelY = (screenHeight - panelH) / 2;
-
-    // Semi-transparent dark overlay
-    DrawRectangle(0, 0, screenWidth, screenHeight, Fade(BLACK, 0.7f));
+    // Smaller help panel - centred by draw(), drawn here at the panel origin
+    int panelW = LEGEND_WIDTH;
+    int panelH = LEGEND_HEIGHT;
+    int panelX = 0;
+    int panelY = 0;
 
     // Help panel
     UITheme::DrawPanel(panelX, panelY, panelW, panelH, UITheme::SECONDARY);
@@ -975,13 +1183,19 @@ void UIManager::drawKeyboardLegend(const FontSystem &fonts)
     fonts.drawText("Cycle Active", col1X + 80, y, UITheme::FONT_SIZE_BODY, UITheme::TEXT_SECONDARY);
     y += 20;
     fonts.drawText("Q-Z", col1X, y, UITheme::FONT_SIZE_BODY, UITheme::ACCENT, true);
-    fonts.drawText("Toggle 1-10", col1X + 80, y, UITheme::FONT_SIZE_BODY, UITheme::TEXT_SECONDARY);
+    fonts.drawText("Toggle Rows 1-10", col1X + 80, y, UITheme::FONT_SIZE_BODY, UITheme::TEXT_SECONDARY);
     y += 20;
     fonts.drawText("CTRL+V", col1X, y, UITheme::FONT_SIZE_BODY, UITheme::ACCENT, true);
-    fonts.drawText("Show All", col1X + 80, y, UITheme::FONT_SIZE_BODY, UITheme::TEXT_SECONDARY);
+    fonts.drawText("Show Listed", col1X + 80, y, UITheme::FONT_SIZE_BODY, UITheme::TEXT_SECONDARY);
     y += 20;
     fonts.drawText("CTRL+B", col1X, y, UITheme::FONT_SIZE_BODY, UITheme::ACCENT, true);
-    fonts.drawText("Hide All", col1X + 80, y, UITheme::FONT_SIZE_BODY, UITheme::TEXT_SECONDARY);
+    fonts.drawText("Hide Listed", col1X + 80, y, UITheme::FONT_SIZE_BODY, UITheme::TEXT_SECONDARY);
+    y += 20;
+    fonts.drawText("/", col1X, y, UITheme::FONT_SIZE_BODY, UITheme::ACCENT, true);
+    fonts.drawText("Search (ENTER ends)", col1X + 80, y, UITheme::FONT_SIZE_BODY, UITheme::TEXT_SECONDARY);
+    y += 20;
+    fonts.drawText("F5-F8", col1X, y, UITheme::FONT_SIZE_BODY, UITheme::ACCENT, true);
+    fonts.drawText("Filter LEO-GEO", col1X + 80, y, UITheme::FONT_SIZE_BODY, UITheme::TEXT_SECONDARY);
 
     // Column 2
     y = panelY + UITheme::SPACING_LG + 40 + UITheme::SPACING_LG;
@@ -1008,6 +1222,9 @@ void UIManager::drawKeyboardLegend(const FontSystem &fonts)
     y += 20;
     fonts.drawText("X", col2X, y, UITheme::FONT_SIZE_BODY, UITheme::ACCENT, true);
     fonts.drawText("This Help", col2X + 60, y, UITheme::FONT_SIZE_BODY, UITheme::TEXT_SECONDARY);
+    y += 20;
+    fonts.drawText("P / F3", col2X, y, UITheme::FONT_SIZE_BODY, UITheme::ACCENT, true);
+    fonts.drawText("Profiler / Save Trace", col2X + 60, y, UITheme::FONT_SIZE_BODY, UITheme::TEXT_SECONDARY);
     y += 28;
 
     fonts.drawText("ORBIT FAMILIES", col2X, y, UITheme::FONT_SIZE_H3, UITheme::WARNING, true);
@@ -1030,6 +1247,115 @@ void UIManager::drawKeyboardLegend(const FontSystem &fonts)
                    UITheme::TEXT_MUTED);
 }
 
+void UIManager::drawProfilerOverlay(const FontSystem &fonts)
+{
+    std::vector<ProfileStat> stats = Profiler::frameStats();
+
+    int panelW = 340;
+    int panelH = 70 + 18 * (int)(stats.empty() ? 1 : stats.size());
+    int panelX = screenWidth - UITheme::SIDEBAR_WIDTH - panelW - UITheme::SPACING_LG;
+    int panelY = UITheme::TITLE_BAR_HEIGHT + UITheme::SPACING_LG;
+
+    // Timings change every frame; the capped refresh also keeps them readable
+    PanelKey values;
+    for (const auto &stat : stats)
+    {
+        values.add(stat.name).add(stat.msPerFrame).add(stat.maxMs)
+            .add((size_t)stat.calls).add(stat.value);
+    }
+
+    if (profilerPanel.needsRedraw(panelW, panelH, stats.size(), values.value()))
+    {
+        profilerPanel.beginRedraw();
+        drawProfilerPanel(fonts, stats);
+        profilerPanel.endRedraw();
+    }
+    profilerPanel.draw(panelX, panelY);
+}
+
+void UIManager::drawProfilerPanel(const FontSystem &fonts, const std::vector<ProfileStat> &stats)
+{
+    int panelW = profilerPanel.getWidth();
+    int panelH = profilerPanel.getHeight();
+    int rowH = 18;
+
+    UITheme::DrawPanel(0, 0, panelW, panelH, UITheme::BORDER_ACCENT);
+
+    int x = UITheme::SPACING_MD;
+    int y = UITheme::SPACING_SM;
+    fonts.drawText("PROFILER", x, y, UITheme::FONT_SIZE_H3, UITheme::SECONDARY, true);
+    y += 24;
+
+    // Column headers
+    fonts.drawText("Scope", x, y, UITheme::FONT_SIZE_SMALL, UITheme::TEXT_MUTED);
+    fonts.drawText("ms/frame", x + 150, y, UITheme::FONT_SIZE_SMALL, UITheme::TEXT_MUTED);
+    fonts.drawText("max", x + 220, y, UITheme::FONT_SIZE_SMALL, UITheme::TEXT_MUTED);
+    fonts.drawText("calls", x + 275, y, UITheme::FONT_SIZE_SMALL, UITheme::TEXT_MUTED);
+    y += rowH + 2;
+
+    if (stats.empty())
+    {
+#if MDV_PROFILE
+        fonts.drawText("No samples yet", x, y, UITheme::FONT_SIZE_SMALL, UITheme::TEXT_SECONDARY);
+#else
+        fonts.drawText("Built without MDV_PROFILE", x, y, UITheme::FONT_SIZE_SMALL, UITheme::WARNING);
+#endif
+        return;
+    }
+
+    char buffer[32];
+    for (const auto &stat : stats)
+    {
+        fonts.drawText(stat.name.c_str(), x, y, UITheme::FONT_SIZE_SMALL, UITheme::TEXT_PRIMARY);
+
+        if (stat.counter)
+        {
+            snprintf(buffer, sizeof(buffer), "%.0f", stat.value);
+            fonts.drawText(buffer, x + 150, y, UITheme::FONT_SIZE_SMALL, UITheme::INFO);
+        }
+        else
+        {
+            // Colour against the 60 Hz frame budget
+            Color timeColor = (stat.msPerFrame < 2.0) ? UITheme::ACCENT : (stat.msPerFrame < 8.0) ? UITheme::WARNING
+                                                                                                   : UITheme::DANGER;
+            snprintf(buffer, sizeof(buffer), "%.3f", stat.msPerFrame);
+            fonts.drawText(buffer, x + 150, y, UITheme::FONT_SIZE_SMALL, timeColor);
+            snprintf(buffer, sizeof(buffer), "%.2f", stat.maxMs);
+            fonts.drawText(buffer, x + 220, y, UITheme::FONT_SIZE_SMALL, UITheme::TEXT_SECONDARY);
+            snprintf(buffer, sizeof(buffer), "%u", stat.calls);
+            fonts.drawText(buffer, x + 275, y, UITheme::FONT_SIZE_SMALL, UITheme::TEXT_SECONDARY);
+        }
+        y += rowH;
+    }
+}
+
+bool UIManager::satelliteAt(Vector2 position, size_t &satelliteIndex) const
+{
+    if (leftSidebarOffset <= -(float)UITheme::SIDEBAR_WIDTH + 10.0f)
+    {
+        return false;
+    }
+
+    int x = (int)leftSidebarOffset;
+    int y = getLeftSidebarY();
+    if (position.x < x || position.x > x + getLeftSidebarWidth() ||
+        position.y < y || position.y > y + getLeftSidebarHeight())
+    {
+        return false;
+    }
+
+    // Rows are laid out in content coordinates, which scroll with the sidebar
+    float rowsTop = y + satelliteRowsY - (int)leftSidebarScroll;
+    if (position.y < rowsTop)
+    {
+        return false;
+    }
+
+    size_t row = (size_t)((position.y - rowsTop) / SATELLITE_ROW_HEIGHT);
+    satelliteIndex = satelliteList.satelliteAtRow(row);
+    return satelliteIndex != SIZE_MAX;
+}
+
 bool UIManager::isMouseOverUI() const
 {
     Vector2 mousePos = GetMousePosition();
@@ -10,12 +10,18 @@
 #include "UITheme.h"
 #include "GroundStation.h" 
 #include "ForceModel.h"
+#include "CachedPanel.h"
+#include "SatelliteListModel.h"
+#include "Profiler.h"
 #include <vector>
 
 // UI Manager - handles all UI rendering with organized layout
 class UIManager {
 public:
     UIManager(int screenWidth, int screenHeight);
+    
+    // Release cached panel textures (call before closing the window)
+    void unload();
      
     // Update animations
     void update(float deltaTime);
@@ -48,6 +54,13 @@ public:
     void toggleEclipse() { showEclipse = !showEclipse; }
     void toggleSolar() { showSolar = !showSolar; }
     void toggleGroundStations() { showGroundStations = !showGroundStations; } 
+    void toggleProfiler() { showProfiler = !showProfiler; }
+    
+    // Background re-propagation progress (shown in force model panel)
+    void setPropagationProgress(size_t completed, size_t total) {
+        propagationCompleted = completed;
+        propagationTotal = total;
+    }
     
     // Getters
     bool isShowingLeftSidebar() const { return showLeftSidebar; }
@@ -56,6 +69,7 @@ public:
     bool isShowingEclipse() const { return showEclipse; }
     bool isShowingSolar() const { return showSolar; }
     bool isShowingGroundStations() const { return showGroundStations; } 
+    bool isShowingProfiler() const { return showProfiler; }
     
     // Legacy getters
     bool isShowingElements() const { return showRightSidebar; }
@@ -64,6 +78,12 @@ public:
     // Check if mouse is over UI
     bool isMouseOverUI() const;
     
+    // Search, filter and scroll state of the satellite list
+    SatelliteListModel& getSatelliteList() { return satelliteList; }
+    
+    // Satellite whose list row is under `position`, if any
+    bool satelliteAt(Vector2 position, size_t& satelliteIndex) const;
+    
 private:
     int screenWidth;
     int screenHeight;
@@ -77,6 +97,11 @@ private:
     bool showEclipse;
     bool showSolar;
     bool showGroundStations; 
+    bool showProfiler;
+    
+    // Re-propagation progress
+    size_t propagationCompleted;
+    size_t propagationTotal;
     
     // Animation state
     float leftSidebarOffset;
@@ -88,6 +113,23 @@ private:
     float leftSidebarScroll;
     float leftSidebarContentHeight;
     
+    // Satellite list (virtualized: only the visible window is laid out)
+    SatelliteListModel satelliteList;
+    size_t listedActiveIndex;
+    int satelliteRowsY;         // Top of the first row, left sidebar content coordinates
+    
+    // Retained panels, re-rendered only when their inputs change
+    CachedPanel titlePanel;
+    CachedPanel statusPanel;
+    CachedPanel leftContentPanel;
+    CachedPanel rightPanel;
+    CachedPanel legendPanel;
+    CachedPanel profilerPanel;
+    
+    static constexpr int SATELLITE_ROW_HEIGHT = 24;
+    static constexpr int LEGEND_WIDTH = 580;
+    static constexpr int LEGEND_HEIGHT = 540;
+    
     // Layout calculations
     int getLeftSidebarX() const { return 0; }
     int getLeftSidebarY() const { return UITheme::TITLE_BAR_HEIGHT; }
@@ -125,6 +167,16 @@ private:
         const std::vector<AccessStatistics>& accessStats,
         const ForceModel& forceModel         
     );
+    void drawLeftSidebarContent(
+        const FontSystem& fonts,
+        const std::vector<Satellite>& satellites,
+        size_t activeSatIndex,
+        const Vector3D& sunDirection,
+        const std::vector<GroundStation>& groundStations,
+        const std::vector<AccessStatistics>& accessStats,
+        const ForceModel& forceModel,
+        int width
+    );
     void drawSatelliteList(
         const FontSystem& fonts,
         const std::vector<Satellite>& satellites,
@@ -177,6 +229,10 @@ private:
     
     // Help overlay
     void drawKeyboardLegend(const FontSystem& fonts);
+    
+    // Per-subsystem timings from the profiler
+    void drawProfilerOverlay(const FontSystem& fonts);
+    void drawProfilerPanel(const FontSystem& fonts, const std::vector<ProfileStat>& stats);
 };
 
 #endif // UI_MANAGER_H
\ No newline at end of file
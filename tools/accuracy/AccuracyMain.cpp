@@ -0,0 +1,505 @@
+// mdv_accuracy: accuracy-vs-cost comparison of the integrators
+//
+//   mdv_accuracy [--orbits=<n>] [--preset=<name>] [--target=<km>] [--csv=<file>]
+//
+// Every preset is propagated with every integrator, for a range of step
+// sizes and for point-mass and J2 force models. Each run is compared
+// sample-by-sample against a reference RK4 solution with a step of one
+// second or less:
+//
+//   energy error    max |E - E_ref| / |E_ref(0)|   (StateVector::orbitalEnergy)
+//   momentum error  max |h - h_ref| / |h_ref(0)|
+//   position error  max |r - r_ref| (km), and at the final time
+//
+// Comparing to the reference rather than to the initial value keeps the
+// metrics meaningful with J2, where Keplerian energy and angular momentum
+// oscillate physically. The reference's own error is estimated by step
+// doubling (Richardson, p = 4) and printed as the accuracy floor.
+//
+// The summary lists, per preset and force model, the cheapest configuration
+// (fewest force evaluations) whose max position error meets --target.
+//
+// A last table checks CompactTrajectory on each preset's reference run,
+// resampled at the visualizer's rate: bytes per state, size ratio against
+// std::vector<StateVector>, and the measured max decode error next to the
+// container's guaranteed bound. Each of those trajectories is also written
+// to a scratch TrajectoryCache, decoded in place from the mapped entry and
+// checked against the bound, and then damaged (truncated, and
+// with per-station window counts that wrap around to the stored total); the
+// damaged files must be rejected by open().
+//
+// The ephemeris table fits each preset with OrbitPropagator::propagateEphemeris
+// (RK4 at the visualizer's rate), saves it, loads it back and evaluates the
+// loaded copy at every reference time, i.e. between the fitted samples too.
+// propagateEphemeris halves the step while the fit misses its tolerance;
+// "step" is the one it settled on and "RK4 dr" the error of the plain RK4
+// samples at that step, so the rest of "eval dr" is fit and interpolation.
+//
+// A measured storage error above its bound, an accepted damaged file, an
+// ephemeris outside its tolerance or one that does not survive the file
+// round trip fails the run with exit code 2.
+
+#include "ChebyshevEphemeris.h"
+#include "CompactTrajectory.h"
+#include "Constants.h"
+#include "Integrator.h"
+#include "OrbitPresets.h"
+#include "OrbitPropagator.h"
+#include "TrajectoryCache.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace {
+    const int STEPS_PER_ORBIT[] = {90, 180, 360, 720, 1440, 2880};
+    const int REFERENCE_BASE_STEPS = 2880;      // Multiple of every entry above
+    const double REFERENCE_MAX_STEP = 1.0;      // seconds
+
+    struct Run {
+        std::string preset;
+        std::string integrator;
+        std::string forceModel;
+        int stepsPerOrbit;
+        double step;
+        long long forceEvaluations;
+        double wallMs;
+        double energyError;
+        double momentumError;
+        double maxPositionError;
+        double finalPositionError;
+    };
+
+    // All integrators under comparison
+    std::vector<std::unique_ptr<Integrator>> makeIntegrators() {
+        std::vector<std::unique_ptr<Integrator>> integrators;
+        integrators.push_back(std::make_unique<EulerIntegrator>());
+        integrators.push_back(std::make_unique<RK4Integrator>());
+        integrators.push_back(std::make_unique<RKN4Integrator>());
+        integrators.push_back(std::make_unique<StormerExtrapolationIntegrator>(4));
+        integrators.push_back(std::make_unique<StormerExtrapolationIntegrator>(6));
+        integrators.push_back(std::make_unique<AdamsBashforthMoultonIntegrator>());
+        integrators.push_back(std::make_unique<EnckeIntegrator>());
+        integrators.push_back(std::make_unique<SundmanIntegrator>());
+        integrators.push_back(std::make_unique<LeapfrogIntegrator>());
+        integrators.push_back(std::make_unique<Yoshida4Integrator>());
+        integrators.push_back(std::make_unique<Yoshida6Integrator>());
+        integrators.push_back(std::make_unique<Yoshida8Integrator>());
+        return integrators;
+    }
+
+    std::vector<StateVector> integrate(const Integrator& integrator, const StateVector& initial,
+                                       double step, long long steps, const ForceModel& forces) {
+        return integrator.integrate(initial, step, static_cast<size_t>(steps), MU_EARTH, forces);
+    }
+
+    struct StorageRun {
+        std::string preset;
+        std::string forceModel;
+        const char* encoding;
+        size_t states;
+        double bytesPerState;
+        double ratio;
+        double positionError;       // km, measured
+        double positionBound;       // km, guaranteed
+        double velocityError;       // km/s, measured
+        double velocityBound;       // km/s, guaranteed
+    };
+
+    StorageRun measureStorage(const std::string& preset, const char* forceModel,
+                              const std::vector<StateVector>& states, TrajectoryEncoding encoding) {
+        CompactTrajectory compact = CompactTrajectory::encode(states, encoding);
+        std::vector<StateVector> decoded = compact.decode();
+
+        StorageRun run;
+        run.preset = preset;
+        run.forceModel = forceModel;
+        run.encoding = (encoding == TrajectoryEncoding::Float32) ? "float32" : "delta16";
+        run.states = states.size();
+        run.bytesPerState = static_cast<double>(compact.memoryBytes()) / states.size();
+        run.ratio = static_cast<double>(states.size() * sizeof(StateVector)) / compact.memoryBytes();
+        run.positionError = 0.0;
+        run.velocityError = 0.0;
+        for (size_t i = 0; i < states.size(); i++) {
+            run.positionError = std::max(run.positionError, (decoded[i].position - states[i].position).magnitude());
+            run.velocityError = std::max(run.velocityError, (decoded[i].velocity - states[i].velocity).magnitude());
+        }
+        run.positionBound = compact.maxPositionError();
+        run.velocityBound = compact.maxVelocityError();
+        return run;
+    }
+
+    struct EphemerisRun {
+        std::string preset;
+        std::string forceModel;
+        size_t segments;
+        double step;                // s, sampling the fit settled on
+        double kiloBytes;
+        double fitError;            // km, on the fitted samples
+        bool withinTolerance;
+        double sampleError;         // km, RK4 samples vs reference
+        double evaluateError;       // km, loaded ephemeris vs reference
+        bool reloaded;              // Loaded copy evaluates bit-identically
+    };
+
+    EphemerisRun measureEphemeris(const OrbitPreset& preset, const char* forceModel, const ForceModel& forces,
+                                  double span, const std::vector<StateVector>& reference,
+                                  const std::string& path) {
+        OrbitPropagator propagator(MU_EARTH);
+        propagator.setForceModel(forces);
+        double step = preset.period / ORBIT_SAMPLES_PER_PERIOD;
+        ChebyshevEphemeris fitted = propagator.propagateEphemeris(
+            preset.initialState, span, step, ChebyshevEphemeris::DEFAULT_DEGREE,
+            ChebyshevEphemeris::DEFAULT_TOLERANCE, &step);
+
+        EphemerisRun run;
+        run.preset = preset.name;
+        run.forceModel = forceModel;
+        run.segments = fitted.segmentCount();
+        run.step = step;
+        run.kiloBytes = fitted.memoryBytes() / 1024.0;
+        run.fitError = fitted.maxPositionError();
+        run.withinTolerance = fitted.withinTolerance();
+
+        ChebyshevEphemeris loaded;
+        run.reloaded = fitted.save(path) && ChebyshevEphemeris::load(path, loaded) &&
+                       loaded.segmentCount() == fitted.segmentCount() &&
+                       loaded.maxPositionError() == fitted.maxPositionError() &&
+                       loaded.getTolerance() == fitted.getTolerance();
+        std::remove(path.c_str());
+
+        run.evaluateError = 0.0;
+        for (const auto& ref : reference) {
+            StateVector state = loaded.evaluate(ref.time);
+            StateVector original = fitted.evaluate(ref.time);
+            if (state.position.x != original.position.x || state.position.y != original.position.y ||
+                state.position.z != original.position.z) {
+                run.reloaded = false;
+            }
+            run.evaluateError = std::max(run.evaluateError, (state.position - ref.position).magnitude());
+        }
+
+        // Compare the samples that land on a reference time
+        std::vector<StateVector> samples = propagator.propagate(preset.initialState, span, step);
+        double referenceStep = reference[1].time - reference[0].time;
+        run.sampleError = 0.0;
+        for (const auto& sample : samples) {
+            double index = (sample.time - reference[0].time) / referenceStep;
+            size_t nearest = static_cast<size_t>(std::llround(index));
+            if (nearest >= reference.size() || std::fabs(index - nearest) > 1e-6) continue;
+            run.sampleError = std::max(run.sampleError, (sample.position - reference[nearest].position).magnitude());
+        }
+        return run;
+    }
+
+    bool readFile(const std::string& path, std::string& bytes) {
+        std::ifstream file(path, std::ios::binary);
+        bytes.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+        return static_cast<bool>(file) || file.eof();
+    }
+
+    bool writeFile(const std::string& path, const std::string& bytes) {
+        std::ofstream file(path, std::ios::binary | std::ios::trunc);
+        file.write(bytes.data(), bytes.size());
+        return static_cast<bool>(file);
+    }
+
+    // Store `states` in a scratch cache, read it back, then check that damaged
+    // copies of the file are rejected. Returns the number of failed checks.
+    int checkCacheFile(const TrajectoryCache& cache, const std::string& key,
+                       const std::vector<StateVector>& states,
+                       const std::vector<AccessStatistics>& accessStats) {
+        int failures = 0;
+        std::filesystem::remove_all(cache.getDirectory());
+        CompactTrajectory compact = CompactTrajectory::encode(states);
+        if (!cache.store(key, compact, accessStats)) return 1;
+
+        CachedTrajectory entry;
+        if (!cache.open(key, entry) || entry.size() != states.size() ||
+            entry.accessStatistics().size() != accessStats.size()) {
+            return 1;
+        }
+
+        // Decoded straight from the mapping, within the stored bound
+        std::shared_ptr<const CompactTrajectory> mapped = entry.getTrajectory();
+        for (size_t i = 0; i < states.size(); i++) {
+            if ((mapped->state(i).position - states[i].position).magnitude() > mapped->maxPositionError()) {
+                failures++;
+                break;
+            }
+        }
+
+        std::filesystem::path path = *std::filesystem::directory_iterator(cache.getDirectory());
+        std::string original;
+        if (!readFile(path.string(), original)) return 1;
+
+        // Truncated by one record
+        std::string damaged = original.substr(0, original.size() - 8);
+        writeFile(path.string(), damaged);
+        if (cache.open(key, entry)) failures++;
+
+        // Window counts {UINT64_MAX, total + 1, 0, ...}: the sum wraps to the
+        // stored total. The counts precede the 40-byte window records.
+        if (accessStats.size() >= 2) {
+            uint64_t total = 0;
+            for (const auto& stats : accessStats) total += stats.windows.size();
+            size_t countsOffset = original.size() - total * 40 - accessStats.size() * sizeof(uint64_t);
+
+            damaged = original;
+            std::vector<uint64_t> counts(accessStats.size(), 0);
+            counts[0] = UINT64_MAX;
+            counts[1] = total + 1;
+            std::memcpy(&damaged[countsOffset], counts.data(), counts.size() * sizeof(uint64_t));
+            writeFile(path.string(), damaged);
+            if (cache.open(key, entry)) failures++;
+        }
+
+        std::filesystem::remove_all(cache.getDirectory());
+        return failures;
+    }
+
+    bool flagValue(const char* arg, const char* flag, std::string& value) {
+        size_t length = std::strlen(flag);
+        if (std::strncmp(arg, flag, length) != 0 || arg[length] != '=') return false;
+        value = arg + length + 1;
+        return true;
+    }
+}
+
+int main(int argc, char** argv) {
+    int orbits = 1;
+    double target = 1.0;
+    std::string presetFilter;
+    std::string csvPath;
+
+    for (int i = 1; i < argc; i++) {
+        std::string value;
+        if (flagValue(argv[i], "--orbits", value)) {
+            orbits = std::max(1, std::atoi(value.c_str()));
+        } else if (flagValue(argv[i], "--target", value)) {
+            target = std::atof(value.c_str());
+        } else if (flagValue(argv[i], "--preset", value)) {
+            presetFilter = value;
+        } else if (flagValue(argv[i], "--csv", value)) {
+            csvPath = value;
+        } else {
+            std::cerr << "Usage: mdv_accuracy [--orbits=<n>] [--preset=<name>] [--target=<km>] [--csv=<file>]\n";
+            return 1;
+        }
+    }
+
+    std::vector<std::unique_ptr<Integrator>> integrators = makeIntegrators();
+    RK4Integrator referenceIntegrator;
+
+    ForceModel pointMass;
+    ForceModel withJ2;
+    withJ2.j2Perturbation = true;
+    const std::pair<const char*, ForceModel> forceModels[] = {{"point-mass", pointMass}, {"J2", withJ2}};
+
+    std::vector<Run> runs;
+    std::vector<StorageRun> storageRuns;
+    std::vector<EphemerisRun> ephemerisRuns;
+    char line[256];
+    
+    std::string ephemerisPath = (std::filesystem::temp_directory_path() / "mdv_accuracy.cheb").string();
+    
+    TrajectoryCache scratchCache((std::filesystem::temp_directory_path() / "mdv_accuracy_cache").string());
+    std::vector<GroundStation> stations = GroundStationPresets::getAllStations();
+    int cacheChecks = 0;
+    int cacheFailures = 0;
+
+    for (const auto& preset : OrbitPresets::getAllPresets(MU_EARTH)) {
+        if (!presetFilter.empty() && preset.name != presetFilter) continue;
+
+        for (const auto& model : forceModels) {
+            // Reference: finest step that all test steps divide evenly
+            int k = static_cast<int>(std::ceil(preset.period / REFERENCE_BASE_STEPS / REFERENCE_MAX_STEP));
+            long long refSteps = static_cast<long long>(REFERENCE_BASE_STEPS) * k * orbits;
+            double span = preset.period * orbits;
+            double refStep = span / refSteps;
+
+            std::vector<StateVector> reference =
+                integrate(referenceIntegrator, preset.initialState, refStep, refSteps, model.second);
+            std::vector<StateVector> coarse =
+                integrate(referenceIntegrator, preset.initialState, 2.0 * refStep, refSteps / 2, model.second);
+            double floor = (reference.back().position - coarse.back().position).magnitude() / 15.0;
+
+            std::snprintf(line, sizeof(line), "%s, %s: reference step %.3f s, error floor ~%.2e km\n",
+                          preset.name.c_str(), model.first, refStep, floor);
+            std::cout << line;
+
+            // Storage check on the visualizer's sampling of the reference
+            long long storageStride = std::max(1LL, refSteps / (static_cast<long long>(ORBIT_SAMPLES_PER_PERIOD) * orbits));
+            std::vector<StateVector> sampled;
+            for (long long i = 0; i <= refSteps; i += storageStride) sampled.push_back(reference[i]);
+            for (TrajectoryEncoding encoding : {TrajectoryEncoding::Float32, TrajectoryEncoding::Delta16}) {
+                storageRuns.push_back(measureStorage(preset.name, model.first, sampled, encoding));
+            }
+            
+            std::vector<AccessStatistics> accessStats;
+            for (const auto& station : stations) {
+                accessStats.push_back(GroundStationAccess::calculateAccessWindows(sampled, station, EARTH_RADIUS));
+            }
+            std::string key = TrajectoryCache::makeKey(preset.initialState, span, refStep * storageStride,
+                                                       MU_EARTH, model.second, referenceIntegrator.name(), stations);
+            cacheFailures += checkCacheFile(scratchCache, key, sampled, accessStats);
+            cacheChecks++;
+
+            ephemerisRuns.push_back(measureEphemeris(preset, model.first, model.second, span,
+                                                     reference, ephemerisPath));
+
+            double energy0 = std::fabs(reference.front().orbitalEnergy(MU_EARTH));
+            double momentum0 = reference.front().angularMomentum().magnitude();
+
+            for (const auto& integrator : integrators) {
+                for (int stepsPerOrbit : STEPS_PER_ORBIT) {
+                    long long steps = static_cast<long long>(stepsPerOrbit) * orbits;
+                    double step = span / steps;
+                    long long stride = refSteps / steps;
+
+                    auto start = std::chrono::steady_clock::now();
+                    std::vector<StateVector> states =
+                        integrate(*integrator, preset.initialState, step, steps, model.second);
+                    double wallMs = std::chrono::duration<double, std::milli>(
+                        std::chrono::steady_clock::now() - start).count();
+
+                    Run run;
+                    run.preset = preset.name;
+                    run.integrator = integrator->name();
+                    run.forceModel = model.first;
+                    run.stepsPerOrbit = stepsPerOrbit;
+                    run.step = step;
+                    run.forceEvaluations = steps * integrator->forceEvaluationsPerStep();
+                    run.wallMs = wallMs;
+                    run.energyError = 0.0;
+                    run.momentumError = 0.0;
+                    run.maxPositionError = 0.0;
+
+                    for (long long i = 0; i <= steps; i++) {
+                        const StateVector& s = states[i];
+                        const StateVector& ref = reference[i * stride];
+
+                        run.energyError = std::max(run.energyError,
+                            std::fabs(s.orbitalEnergy(MU_EARTH) - ref.orbitalEnergy(MU_EARTH)) / energy0);
+                        run.momentumError = std::max(run.momentumError,
+                            (s.angularMomentum() - ref.angularMomentum()).magnitude() / momentum0);
+                        run.maxPositionError = std::max(run.maxPositionError,
+                            (s.position - ref.position).magnitude());
+                    }
+                    run.finalPositionError = (states.back().position - reference.back().position).magnitude();
+
+                    // Diverged runs (e.g. Euler at coarse steps) report as infinite
+                    if (!std::isfinite(run.maxPositionError) || !std::isfinite(run.finalPositionError)) {
+                        run.energyError = run.momentumError = INFINITY;
+                        run.maxPositionError = run.finalPositionError = INFINITY;
+                    }
+                    runs.push_back(run);
+                }
+            }
+        }
+    }
+
+    // Full table
+    std::snprintf(line, sizeof(line), "\n%-10s %-9s %-11s %6s %9s %10s %9s %10s %10s %11s %11s\n",
+                  "Preset", "Integ.", "Forces", "N/orb", "step [s]", "f-evals", "wall [ms]",
+                  "dE/E", "dh/h", "max dr[km]", "end dr[km]");
+    std::cout << line;
+    for (const auto& r : runs) {
+        std::snprintf(line, sizeof(line), "%-10s %-9s %-11s %6d %9.2f %10lld %9.3f %10.2e %10.2e %11.3e %11.3e\n",
+                      r.preset.c_str(), r.integrator.c_str(), r.forceModel.c_str(), r.stepsPerOrbit, r.step,
+                      r.forceEvaluations, r.wallMs, r.energyError, r.momentumError,
+                      r.maxPositionError, r.finalPositionError);
+        std::cout << line;
+    }
+
+    // Cheapest configuration per preset and force model
+    std::snprintf(line, sizeof(line), "\nCheapest configuration for max position error <= %g km:\n", target);
+    std::cout << line;
+    for (size_t i = 0; i < runs.size();) {
+        size_t end = i;
+        while (end < runs.size() && runs[end].preset == runs[i].preset &&
+               runs[end].forceModel == runs[i].forceModel) {
+            end++;
+        }
+
+        const Run* best = nullptr;
+        for (size_t j = i; j < end; j++) {
+            if (runs[j].maxPositionError > target) continue;
+            if (!best || runs[j].forceEvaluations < best->forceEvaluations ||
+                (runs[j].forceEvaluations == best->forceEvaluations && runs[j].wallMs < best->wallMs)) {
+                best = &runs[j];
+            }
+        }
+
+        if (best) {
+            std::snprintf(line, sizeof(line), "  %-10s %-11s %-9s N/orb=%-5d %lld f-evals, %.3f ms, max dr %.2e km\n",
+                          runs[i].preset.c_str(), runs[i].forceModel.c_str(), best->integrator.c_str(),
+                          best->stepsPerOrbit, best->forceEvaluations, best->wallMs, best->maxPositionError);
+        } else {
+            std::snprintf(line, sizeof(line), "  %-10s %-11s none of the tested configurations\n",
+                          runs[i].preset.c_str(), runs[i].forceModel.c_str());
+        }
+        std::cout << line;
+        i = end;
+    }
+
+    // Compact storage: measured error must stay within the reported bound
+    bool storageWithinBounds = true;
+    std::snprintf(line, sizeof(line), "\n%-10s %-11s %-8s %7s %9s %6s %11s %11s %12s %12s\n",
+                  "Preset", "Forces", "Storage", "states", "B/state", "ratio",
+                  "dr [km]", "bound [km]", "dv [km/s]", "bound [km/s]");
+    std::cout << line;
+    for (const auto& r : storageRuns) {
+        bool ok = r.positionError <= r.positionBound && r.velocityError <= r.velocityBound;
+        storageWithinBounds = storageWithinBounds && ok;
+        std::snprintf(line, sizeof(line), "%-10s %-11s %-8s %7zu %9.2f %5.2fx %11.2e %11.2e %12.2e %12.2e%s\n",
+                      r.preset.c_str(), r.forceModel.c_str(), r.encoding, r.states, r.bytesPerState, r.ratio,
+                      r.positionError, r.positionBound, r.velocityError, r.velocityBound,
+                      ok ? "" : "  EXCEEDS BOUND");
+        std::cout << line;
+    }
+
+    std::snprintf(line, sizeof(line), "\nTrajectory cache: %d entries round-tripped, %d failed checks "
+                  "(damaged files must be rejected)\n", cacheChecks, cacheFailures);
+    std::cout << line;
+
+    // Chebyshev ephemeris: fit within tolerance and unchanged by save/load
+    bool ephemerisOk = true;
+    std::snprintf(line, sizeof(line), "\n%-10s %-11s %8s %9s %8s %11s %5s %11s %12s %7s\n",
+                  "Preset", "Forces", "segments", "step [s]", "KB", "fit dr[km]", "tol",
+                  "RK4 dr[km]", "eval dr[km]", "reload");
+    std::cout << line;
+    for (const auto& r : ephemerisRuns) {
+        ephemerisOk = ephemerisOk && r.withinTolerance && r.reloaded;
+        std::snprintf(line, sizeof(line), "%-10s %-11s %8zu %9.2f %8.1f %11.2e %5s %11.2e %12.2e %7s\n",
+                      r.preset.c_str(), r.forceModel.c_str(), r.segments, r.step, r.kiloBytes, r.fitError,
+                      r.withinTolerance ? "ok" : "MISS", r.sampleError, r.evaluateError,
+                      r.reloaded ? "ok" : "FAIL");
+        std::cout << line;
+    }
+
+    if (!csvPath.empty()) {
+        std::ofstream csv(csvPath);
+        csv << "preset,integrator,force_model,steps_per_orbit,step_s,force_evaluations,wall_ms,"
+               "energy_error,momentum_error,max_position_error_km,final_position_error_km\n";
+        for (const auto& r : runs) {
+            csv << r.preset << ',' << r.integrator << ',' << r.forceModel << ',' << r.stepsPerOrbit << ','
+                << r.step << ',' << r.forceEvaluations << ',' << r.wallMs << ',' << r.energyError << ','
+                << r.momentumError << ',' << r.maxPositionError << ',' << r.finalPositionError << '\n';
+        }
+        if (!csv) {
+            std::cerr << "Failed to write " << csvPath << "\n";
+            return 1;
+        }
+    }
+
+    return (storageWithinBounds && cacheFailures == 0 && ephemerisOk) ? 0 : 2;
+}
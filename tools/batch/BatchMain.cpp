@@ -0,0 +1,63 @@
+// mdv-batch: headless propagation and analysis over a scenario file
+//
+//   mdv-batch <scenario> [--output <prefix>] [--threads <n>]
+
+#include "Scenario.h"
+#include "BatchRunner.h"
+#include "ReportWriter.h"
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+
+int main(int argc, char** argv) {
+    if (argc < 2) {
+        std::cerr << "Usage: mdv-batch <scenario> [--output <prefix>] [--threads <n>]\n";
+        return 1;
+    }
+
+    Scenario scenario;
+    std::string error;
+    if (!Scenario::load(argv[1], scenario, error)) {
+        std::cerr << "mdv-batch: " << error << "\n";
+        return 1;
+    }
+
+    // Command-line overrides
+    for (int i = 2; i + 1 < argc; i += 2) {
+        std::string flag = argv[i];
+        if (flag == "--output") {
+            scenario.outputPrefix = argv[i + 1];
+        } else if (flag == "--threads") {
+            scenario.threads = static_cast<size_t>(std::atoi(argv[i + 1]));
+        } else {
+            std::cerr << "mdv-batch: unknown option " << flag << "\n";
+            return 1;
+        }
+    }
+
+    size_t pairs = scenario.satellites.size() * scenario.stations.size();
+    std::cout << "Scenario: " << scenario.satellites.size() << " satellites, "
+              << scenario.stations.size() << " stations, "
+              << scenario.span << " s span at " << scenario.step << " s step\n";
+
+    auto start = std::chrono::steady_clock::now();
+    std::vector<SatelliteReport> reports = BatchRunner::run(scenario);
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    std::cout << "Analyzed in " << seconds << " s ("
+              << (seconds > 0.0 ? scenario.satellites.size() / seconds : 0.0) << " satellites/s, "
+              << (seconds > 0.0 ? pairs / seconds : 0.0) << " pairs/s)\n";
+
+    bool ok = true;
+    if (scenario.writeCsv) ok &= ReportWriter::writeCsv(scenario.outputPrefix, scenario.stations, reports);
+    if (scenario.writeJson) ok &= ReportWriter::writeJson(scenario.outputPrefix, scenario.stations, reports);
+    if (scenario.writeBinary) ok &= ReportWriter::writeBinary(scenario.outputPrefix, scenario.stations, reports);
+
+    if (!ok) {
+        std::cerr << "mdv-batch: failed to write reports to " << scenario.outputPrefix << "\n";
+        return 1;
+    }
+    std::cout << "Reports written to " << scenario.outputPrefix << "*\n";
+    return 0;
+}
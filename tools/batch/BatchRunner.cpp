@@ -0,0 +1,71 @@
+#include "BatchRunner.h"
+#include "OrbitPropagator.h"
+#include "Eclipse.h"
+#include "SolarAnalysis.h"
+#include "ThreadPool.h"
+#include "Constants.h"
+
+std::vector<SatelliteReport> BatchRunner::run(const Scenario& scenario) {
+    std::vector<SatelliteReport> reports(scenario.satellites.size());
+
+    // One task per satellite; each writes only its own slot
+    ThreadPool pool(scenario.threads);
+    for (size_t i = 0; i < scenario.satellites.size(); i++) {
+        pool.submit([&scenario, &reports, i]() {
+            reports[i] = analyze(scenario, scenario.satellites[i]);
+        });
+    }
+    pool.waitIdle();
+
+    return reports;
+}
+
+SatelliteReport BatchRunner::analyze(const Scenario& scenario, const ScenarioSatellite& satellite) {
+    SatelliteReport report;
+    report.name = satellite.name;
+
+    OrbitPropagator propagator(MU_EARTH);
+    propagator.setForceModel(scenario.forceModel);
+    std::vector<StateVector> trajectory =
+        propagator.propagate(satellite.initialState, scenario.span, scenario.step);
+
+    report.samples = trajectory.size();
+    report.orbit = Satellite::computeStatistics(trajectory, EARTH_RADIUS);
+
+    // Eclipse and solar conditions at every sample
+    bool wasInUmbra = false;
+    double efficiencySum = 0.0;
+    double betaSum = 0.0;
+    for (const auto& state : trajectory) {
+        EclipseStatus eclipse = EclipseDetector::checkEclipse(
+            state.position, scenario.sunDirection, EARTH_RADIUS);
+
+        if (eclipse.inUmbra) {
+            report.umbraTime += scenario.step;
+            if (!wasInUmbra) report.eclipseCount++;
+        } else if (eclipse.inPenumbra) {
+            report.penumbraTime += scenario.step;
+        }
+        wasInUmbra = eclipse.inUmbra;
+
+        SolarPanelAnalysis solar = SolarAnalyzer::analyze(
+            state.position, state.velocity, scenario.sunDirection, eclipse);
+        efficiencySum += solar.solarEfficiency;
+        betaSum += solar.betaAngle;
+    }
+
+    if (!trajectory.empty()) {
+        double n = static_cast<double>(trajectory.size());
+        report.meanSolarEfficiency = efficiencySum / n;
+        report.meanBetaAngle = betaSum / n;
+        report.eclipseFraction = (report.umbraTime + report.penumbraTime) / (n * scenario.step);
+    }
+
+    report.access.reserve(scenario.stations.size());
+    for (const auto& station : scenario.stations) {
+        report.access.push_back(
+            GroundStationAccess::calculateAccessWindows(trajectory, station, EARTH_RADIUS));
+    }
+
+    return report;
+}
@@ -0,0 +1,39 @@
+#ifndef BATCH_RUNNER_H
+#define BATCH_RUNNER_H
+
+#include "Scenario.h"
+#include "Satellite.h"
+#include "GroundStation.h"
+#include <string>
+#include <vector>
+
+// Everything computed for one satellite over the scenario span
+struct SatelliteReport {
+    std::string name;
+    size_t samples = 0;
+    OrbitStatistics orbit{};
+
+    // Eclipse (sample-and-hold over the step)
+    double umbraTime = 0.0;         // seconds
+    double penumbraTime = 0.0;      // seconds
+    int eclipseCount = 0;           // Umbra entries
+    double eclipseFraction = 0.0;   // (umbra + penumbra) / span
+
+    // Solar panels
+    double meanSolarEfficiency = 0.0;
+    double meanBetaAngle = 0.0;     // degrees
+
+    // One entry per scenario station
+    std::vector<AccessStatistics> access;
+};
+
+// Runs propagation and analysis for every satellite on a thread pool
+class BatchRunner {
+public:
+    static std::vector<SatelliteReport> run(const Scenario& scenario);
+
+    // Analyze one satellite (also used directly by run's worker tasks)
+    static SatelliteReport analyze(const Scenario& scenario, const ScenarioSatellite& satellite);
+};
+
+#endif // BATCH_RUNNER_H
@@ -0,0 +1,195 @@
+#include "ReportWriter.h"
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iomanip>
+
+namespace {
+    const uint32_t BINARY_VERSION = 1;
+
+    // Quote a CSV field only when it needs it
+    std::string csvField(const std::string& text) {
+        if (text.find_first_of(",\"\n") == std::string::npos) return text;
+        std::string quoted = "\"";
+        for (char c : text) {
+            if (c == '"') quoted += '"';
+            quoted += c;
+        }
+        return quoted + "\"";
+    }
+
+    std::string jsonString(const std::string& text) {
+        std::string out = "\"";
+        for (char c : text) {
+            switch (c) {
+                case '"':  out += "\\\""; break;
+                case '\\': out += "\\\\"; break;
+                case '\n': out += "\\n"; break;
+                case '\t': out += "\\t"; break;
+                default:
+                    if (static_cast<unsigned char>(c) < 0x20) {
+                        char escaped[8];
+                        std::snprintf(escaped, sizeof(escaped), "\\u%04x", c);
+                        out += escaped;
+                    } else {
+                        out += c;
+                    }
+            }
+        }
+        return out + "\"";
+    }
+
+    template <typename T>
+    void writeRaw(std::ofstream& file, const T& value) {
+        file.write(reinterpret_cast<const char*>(&value), sizeof(T));
+    }
+}
+
+bool ReportWriter::writeCsv(const std::string& prefix,
+                            const std::vector<GroundStation>& stations,
+                            const std::vector<SatelliteReport>& reports) {
+    std::ofstream sats(prefix + "_satellites.csv");
+    std::ofstream access(prefix + "_access.csv");
+    std::ofstream windows(prefix + "_windows.csv");
+    if (!sats || !access || !windows) return false;
+
+    sats << std::setprecision(10);
+    access << std::setprecision(10);
+    windows << std::setprecision(10);
+
+    sats << "satellite,samples,family,periapsis_alt_km,apoapsis_alt_km,mean_alt_km,"
+            "periapsis_vel_kms,apoapsis_vel_kms,umbra_s,penumbra_s,eclipses,"
+            "eclipse_fraction,mean_solar_efficiency,mean_beta_deg\n";
+    access << "satellite,station,passes,total_access_s,average_pass_s,longest_pass_s,shortest_pass_s\n";
+    windows << "satellite,station,start_s,end_s,duration_s,max_elevation_deg\n";
+
+    for (const auto& r : reports) {
+        sats << csvField(r.name) << ',' << r.samples << ',' << r.orbit.orbitFamily << ','
+             << r.orbit.periapsisAlt << ',' << r.orbit.apoapsisAlt << ',' << r.orbit.meanAltitude << ','
+             << r.orbit.periapsisVel << ',' << r.orbit.apoapsisVel << ','
+             << r.umbraTime << ',' << r.penumbraTime << ',' << r.eclipseCount << ','
+             << r.eclipseFraction << ',' << r.meanSolarEfficiency << ',' << r.meanBetaAngle << '\n';
+
+        for (size_t s = 0; s < r.access.size(); s++) {
+            const AccessStatistics& a = r.access[s];
+            std::string station = csvField(stations[s].code.empty() ? stations[s].name : stations[s].code);
+
+            access << csvField(r.name) << ',' << station << ',' << a.passesPerOrbit << ','
+                   << a.totalAccessTime << ',' << a.averagePassDuration << ','
+                   << a.longestPass << ',' << a.shortestPass << '\n';
+
+            for (const auto& w : a.windows) {
+                windows << csvField(r.name) << ',' << station << ',' << w.startTime << ','
+                        << w.endTime << ',' << w.duration << ',' << w.maxElevation << '\n';
+            }
+        }
+    }
+
+    return static_cast<bool>(sats) && static_cast<bool>(access) && static_cast<bool>(windows);
+}
+
+bool ReportWriter::writeJson(const std::string& prefix,
+                             const std::vector<GroundStation>& stations,
+                             const std::vector<SatelliteReport>& reports) {
+    std::ofstream file(prefix + ".json");
+    if (!file) return false;
+    file << std::setprecision(10);
+
+    file << "{\n  \"stations\": [";
+    for (size_t s = 0; s < stations.size(); s++) {
+        const GroundStation& st = stations[s];
+        file << (s ? "," : "") << "\n    {\"name\": " << jsonString(st.name)
+             << ", \"code\": " << jsonString(st.code)
+             << ", \"lat\": " << st.location.latitude
+             << ", \"lon\": " << st.location.longitude
+             << ", \"alt\": " << st.location.altitude
+             << ", \"min_elevation\": " << st.minElevation << "}";
+    }
+    file << "\n  ],\n  \"satellites\": [";
+
+    for (size_t i = 0; i < reports.size(); i++) {
+        const SatelliteReport& r = reports[i];
+        file << (i ? "," : "") << "\n    {\n"
+             << "      \"name\": " << jsonString(r.name) << ",\n"
+             << "      \"samples\": " << r.samples << ",\n"
+             << "      \"orbit\": {\"family\": " << jsonString(r.orbit.orbitFamily)
+             << ", \"periapsis_alt\": " << r.orbit.periapsisAlt
+             << ", \"apoapsis_alt\": " << r.orbit.apoapsisAlt
+             << ", \"mean_alt\": " << r.orbit.meanAltitude
+             << ", \"periapsis_vel\": " << r.orbit.periapsisVel
+             << ", \"apoapsis_vel\": " << r.orbit.apoapsisVel << "},\n"
+             << "      \"eclipse\": {\"umbra\": " << r.umbraTime
+             << ", \"penumbra\": " << r.penumbraTime
+             << ", \"count\": " << r.eclipseCount
+             << ", \"fraction\": " << r.eclipseFraction << "},\n"
+             << "      \"solar\": {\"mean_efficiency\": " << r.meanSolarEfficiency
+             << ", \"mean_beta\": " << r.meanBetaAngle << "},\n"
+             << "      \"access\": [";
+
+        for (size_t s = 0; s < r.access.size(); s++) {
+            const AccessStatistics& a = r.access[s];
+            file << (s ? "," : "") << "\n        {\"station\": " << s
+                 << ", \"passes\": " << a.passesPerOrbit
+                 << ", \"total\": " << a.totalAccessTime
+                 << ", \"average\": " << a.averagePassDuration
+                 << ", \"longest\": " << a.longestPass
+                 << ", \"shortest\": " << a.shortestPass
+                 << ", \"windows\": [";
+            for (size_t w = 0; w < a.windows.size(); w++) {
+                const AccessWindow& win = a.windows[w];
+                file << (w ? ", " : "") << "[" << win.startTime << ", " << win.endTime
+                     << ", " << win.maxElevation << "]";
+            }
+            file << "]}";
+        }
+        file << (r.access.empty() ? "]\n" : "\n      ]\n") << "    }";
+    }
+    file << "\n  ]\n}\n";
+
+    return static_cast<bool>(file);
+}
+
+bool ReportWriter::writeBinary(const std::string& prefix,
+                               const std::vector<GroundStation>& stations,
+                               const std::vector<SatelliteReport>& reports) {
+    std::ofstream file(prefix + ".bin", std::ios::binary);
+    if (!file) return false;
+
+    file.write("MDVBATCH", 8);
+    writeRaw(file, BINARY_VERSION);
+    writeRaw(file, static_cast<uint32_t>(reports.size()));
+    writeRaw(file, static_cast<uint32_t>(stations.size()));
+    writeRaw(file, static_cast<uint32_t>(0));
+
+    for (const auto& r : reports) {
+        char name[32] = {};
+        std::strncpy(name, r.name.c_str(), sizeof(name) - 1);
+        file.write(name, sizeof(name));
+
+        writeRaw(file, static_cast<uint64_t>(r.samples));
+        writeRaw(file, r.orbit.periapsisAlt);
+        writeRaw(file, r.orbit.apoapsisAlt);
+        writeRaw(file, r.orbit.meanAltitude);
+        writeRaw(file, r.umbraTime);
+        writeRaw(file, r.penumbraTime);
+        writeRaw(file, r.eclipseFraction);
+        writeRaw(file, r.meanSolarEfficiency);
+        writeRaw(file, r.meanBetaAngle);
+        writeRaw(file, static_cast<int32_t>(r.eclipseCount));
+        writeRaw(file, static_cast<int32_t>(r.orbit.family));
+    }
+
+    for (const auto& r : reports) {
+        for (const auto& a : r.access) {
+            writeRaw(file, static_cast<int32_t>(a.passesPerOrbit));
+            writeRaw(file, static_cast<int32_t>(0));
+            writeRaw(file, a.totalAccessTime);
+            writeRaw(file, a.averagePassDuration);
+            writeRaw(file, a.longestPass);
+            writeRaw(file, a.shortestPass);
+        }
+    }
+
+    return static_cast<bool>(file);
+}
@@ -0,0 +1,37 @@
+#ifndef REPORT_WRITER_H
+#define REPORT_WRITER_H
+
+#include "BatchRunner.h"
+#include <string>
+#include <vector>
+
+/**
+ * Batch report output. All writers take the scenario output prefix:
+ *
+ *   CSV:    <prefix>_satellites.csv, <prefix>_access.csv, <prefix>_windows.csv
+ *   JSON:   <prefix>.json (one document with everything)
+ *   Binary: <prefix>.bin, little-endian, fixed-size records:
+ *             header    "MDVBATCH", u32 version, u32 satellites, u32 stations, u32 0
+ *             per sat   char name[32], u64 samples, f64 periapsisAlt, apoapsisAlt,
+ *                       meanAltitude, umbraTime, penumbraTime, eclipseFraction,
+ *                       meanSolarEfficiency, meanBetaAngle, i32 eclipseCount,
+ *                       i32 family (0 LEO, 1 MEO, 2 HEO, 3 GEO)
+ *             per pair  (satellite-major) i32 passes, i32 0, f64 totalAccessTime,
+ *                       averagePassDuration, longestPass, shortestPass
+ */
+class ReportWriter {
+public:
+    static bool writeCsv(const std::string& prefix,
+                         const std::vector<GroundStation>& stations,
+                         const std::vector<SatelliteReport>& reports);
+
+    static bool writeJson(const std::string& prefix,
+                          const std::vector<GroundStation>& stations,
+                          const std::vector<SatelliteReport>& reports);
+
+    static bool writeBinary(const std::string& prefix,
+                            const std::vector<GroundStation>& stations,
+                            const std::vector<SatelliteReport>& reports);
+};
+
+#endif // REPORT_WRITER_H
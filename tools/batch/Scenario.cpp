@@ -0,0 +1,217 @@
+#include "Scenario.h"
+#include "OrbitPresets.h"
+#include "Constants.h"
+#include <algorithm>
+#include <cctype>
+#include <fstream>
+#include <sstream>
+
+namespace {
+    std::string trim(const std::string& text) {
+        size_t begin = text.find_first_not_of(" \t\r\n");
+        if (begin == std::string::npos) return "";
+        size_t end = text.find_last_not_of(" \t\r\n");
+        return text.substr(begin, end - begin + 1);
+    }
+
+    std::string lower(std::string text) {
+        std::transform(text.begin(), text.end(), text.begin(),
+                       [](unsigned char c) { return static_cast<char>(std::tolower(c)); });
+        return text;
+    }
+
+    bool parseNumbers(const std::string& text, double* values, size_t count) {
+        std::istringstream stream(text);
+        for (size_t i = 0; i < count; i++) {
+            if (!(stream >> values[i])) return false;
+        }
+        std::string rest;
+        return !(stream >> rest);
+    }
+
+    bool parseNumber(const std::string& text, double& value) {
+        return parseNumbers(text, &value, 1);
+    }
+
+    bool parseBool(const std::string& text, bool& value) {
+        std::string v = lower(text);
+        if (v == "true" || v == "on" || v == "yes" || v == "1") { value = true; return true; }
+        if (v == "false" || v == "off" || v == "no" || v == "0") { value = false; return true; }
+        return false;
+    }
+
+    // name,x,y,z,vx,vy,vz per line; blank lines and # comments skipped
+    bool loadCatalog(const std::string& path, std::vector<ScenarioSatellite>& out, std::string& error) {
+        std::ifstream file(path);
+        if (!file) {
+            error = path + ": cannot open catalog";
+            return false;
+        }
+
+        std::string line;
+        int lineNumber = 0;
+        while (std::getline(file, line)) {
+            lineNumber++;
+            line = trim(line.substr(0, line.find('#')));
+            if (line.empty()) continue;
+
+            size_t comma = line.find(',');
+            std::string numbers = (comma == std::string::npos) ? "" : line.substr(comma + 1);
+            std::replace(numbers.begin(), numbers.end(), ',', ' ');
+
+            double v[6];
+            if (comma == std::string::npos || !parseNumbers(numbers, v, 6)) {
+                error = path + ":" + std::to_string(lineNumber) + ": expected name,x,y,z,vx,vy,vz";
+                return false;
+            }
+
+            ScenarioSatellite sat;
+            sat.name = trim(line.substr(0, comma));
+            sat.initialState = StateVector(Vector3D(v[0], v[1], v[2]), Vector3D(v[3], v[4], v[5]), 0.0);
+            out.push_back(sat);
+        }
+        return true;
+    }
+}
+
+bool Scenario::load(const std::string& path, Scenario& scenario, std::string& error) {
+    std::ifstream file(path);
+    if (!file) {
+        error = path + ": cannot open scenario";
+        return false;
+    }
+
+    enum class Section { Global, Satellite, Station };
+    Section section = Section::Global;
+
+    std::vector<OrbitPreset> presets = OrbitPresets::getAllPresets(MU_EARTH);
+
+    std::string line;
+    int lineNumber = 0;
+    auto fail = [&](const std::string& message) {
+        error = path + ":" + std::to_string(lineNumber) + ": " + message;
+        return false;
+    };
+
+    while (std::getline(file, line)) {
+        lineNumber++;
+        line = trim(line.substr(0, line.find('#')));
+        if (line.empty()) continue;
+
+        // Section headers start a new satellite or station
+        if (line == "[satellite]") {
+            section = Section::Satellite;
+            ScenarioSatellite sat;
+            sat.name = "SAT-" + std::to_string(scenario.satellites.size() + 1);
+            scenario.satellites.push_back(sat);
+            continue;
+        }
+        if (line == "[station]") {
+            section = Section::Station;
+            scenario.stations.push_back(GroundStation());
+            continue;
+        }
+        if (line.front() == '[') return fail("unknown section " + line);
+
+        size_t eq = line.find('=');
+        if (eq == std::string::npos) return fail("expected key = value");
+        std::string key = lower(trim(line.substr(0, eq)));
+        std::string value = trim(line.substr(eq + 1));
+
+        if (section == Section::Satellite) {
+            ScenarioSatellite& sat = scenario.satellites.back();
+            if (key == "name") {
+                sat.name = value;
+            } else if (key == "state") {
+                double v[6];
+                if (!parseNumbers(value, v, 6)) return fail("state needs x y z vx vy vz");
+                sat.initialState = StateVector(Vector3D(v[0], v[1], v[2]), Vector3D(v[3], v[4], v[5]), 0.0);
+            } else if (key == "preset") {
+                auto it = std::find_if(presets.begin(), presets.end(),
+                    [&](const OrbitPreset& p) { return lower(p.name) == lower(value); });
+                if (it == presets.end()) return fail("unknown preset " + value);
+                sat.initialState = it->initialState;
+            } else {
+                return fail("unknown satellite key " + key);
+            }
+            continue;
+        }
+
+        if (section == Section::Station) {
+            GroundStation& station = scenario.stations.back();
+            double number = 0.0;
+            if (key == "name") {
+                station.name = value;
+            } else if (key == "code") {
+                station.code = value;
+            } else if (key == "lat" || key == "lon" || key == "alt" || key == "min_elevation") {
+                if (!parseNumber(value, number)) return fail(key + " must be a number");
+                if (key == "lat") station.location.latitude = number;
+                if (key == "lon") station.location.longitude = number;
+                if (key == "alt") station.location.altitude = number;
+                if (key == "min_elevation") station.minElevation = number;
+            } else {
+                return fail("unknown station key " + key);
+            }
+            continue;
+        }
+
+        // Global settings
+        double number = 0.0;
+        if (key == "span" || key == "step" || key == "threads") {
+            if (!parseNumber(value, number) || number < 0.0) return fail(key + " must be a non-negative number");
+            if (key == "span") scenario.span = number;
+            if (key == "step") scenario.step = number;
+            if (key == "threads") scenario.threads = static_cast<size_t>(number);
+        } else if (key == "j2") {
+            if (!parseBool(value, scenario.forceModel.j2Perturbation)) return fail("j2 must be true or false");
+        } else if (key == "sun") {
+            double v[3];
+            if (!parseNumbers(value, v, 3)) return fail("sun needs x y z");
+            scenario.sunDirection = Vector3D(v[0], v[1], v[2]).normalized();
+        } else if (key == "output") {
+            scenario.outputPrefix = value;
+        } else if (key == "formats") {
+            scenario.writeCsv = scenario.writeJson = scenario.writeBinary = false;
+            std::istringstream stream(lower(value));
+            std::string format;
+            while (stream >> format) {
+                if (format == "csv") scenario.writeCsv = true;
+                else if (format == "json") scenario.writeJson = true;
+                else if (format == "bin") scenario.writeBinary = true;
+                else return fail("unknown format " + format);
+            }
+        } else if (key == "presets") {
+            std::string v = lower(value);
+            if (v == "none") continue;
+            std::replace(v.begin(), v.end(), ',', ' ');
+            std::istringstream stream(v);
+            std::string name;
+            while (stream >> name) {
+                for (const auto& preset : presets) {
+                    if (name == "all" || lower(preset.name) == name) {
+                        scenario.satellites.push_back({preset.name, preset.initialState});
+                    }
+                }
+            }
+        } else if (key == "stations") {
+            std::string v = lower(value);
+            if (v == "all") {
+                std::vector<GroundStation> all = GroundStationPresets::getAllStations();
+                scenario.stations.insert(scenario.stations.end(), all.begin(), all.end());
+            } else if (v != "none") {
+                return fail("stations must be all or none");
+            }
+        } else if (key == "catalog") {
+            if (!loadCatalog(value, scenario.satellites, error)) return false;
+        } else {
+            return fail("unknown key " + key);
+        }
+    }
+
+    if (scenario.step <= 0.0 || scenario.span <= 0.0) {
+        error = path + ": span and step must be positive";
+        return false;
+    }
+    return true;
+}
@@ -0,0 +1,62 @@
+#ifndef SCENARIO_H
+#define SCENARIO_H
+
+#include "StateVector.h"
+#include "ForceModel.h"
+#include "GroundStation.h"
+#include <string>
+#include <vector>
+
+// One satellite to analyze
+struct ScenarioSatellite {
+    std::string name;
+    StateVector initialState;
+};
+
+/**
+ * Batch scenario, read from a plain-text file:
+ *
+ *   # Global settings (key = value)
+ *   span = 86400            # seconds
+ *   step = 30               # seconds
+ *   j2 = true
+ *   sun = 1 0 0             # sun direction (ECI)
+ *   threads = 0             # 0 = all cores
+ *   output = reports/run1   # report path prefix
+ *   formats = csv json bin
+ *   presets = all           # all | none | comma-separated preset names
+ *   stations = all          # all | none (preset ground stations)
+ *   catalog = sats.csv      # name,x,y,z,vx,vy,vz per line (km, km/s)
+ *
+ *   [satellite]
+ *   name = Custom-1
+ *   state = 7000 0 0 0 7.5 0
+ *
+ *   [station]
+ *   name = Svalbard
+ *   code = SVB
+ *   lat = 78.2
+ *   lon = 15.4
+ *   alt = 0.5
+ *   min_elevation = 5
+ */
+struct Scenario {
+    std::vector<ScenarioSatellite> satellites;
+    std::vector<GroundStation> stations;
+    ForceModel forceModel;
+
+    double span = 86400.0;
+    double step = 30.0;
+    Vector3D sunDirection = Vector3D(1.0, 0.0, 0.0);
+    size_t threads = 0;
+
+    std::string outputPrefix = "mdv_batch";
+    bool writeCsv = true;
+    bool writeJson = false;
+    bool writeBinary = false;
+
+    // Parse a scenario file; on failure error holds "file:line: message"
+    static bool load(const std::string& path, Scenario& scenario, std::string& error);
+};
+
+#endif // SCENARIO_H